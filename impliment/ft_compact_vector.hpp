@@ -0,0 +1,471 @@
+#ifndef FT_COMPACT_VECTOR_HPP
+# define FT_COMPACT_VECTOR_HPP
+
+/* ------------------------------- Explanation ------------------------------ */
+// compact_vector<T> is a vector whose object is 16 bytes: the buffer pointer
+// and 32-bit size and capacity. ft::vector carries an allocator, two size_t
+// and a vtable pointer on top of the buffer pointer; that header is paid once
+// per inner vector in a vector of vectors (adjacency lists, buckets).
+//	• there are no virtual functions;
+//	• the allocator is an empty base, so a stateless allocator takes no room
+//	  (a stateful one makes the object bigger, but still works);
+//	• at most 2^32 - 1 elements: max_size() says so and growth stops there.
+// The interface and the iterators (wrap_iter) are the ones of ft::vector.
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Headers --------------------------------- */
+# include <memory>
+# include <algorithm>
+# include <cstdint>
+# include <functional>
+# include <iterator>
+# include <limits>
+# include <utility>
+# include "utility.hpp"
+# include "iterator.hpp"
+# include "reverse_iterator.hpp"
+# include "relocate.hpp"
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+
+	template <typename T, typename Alloc = std::allocator<T> >
+	class compact_vector : private Alloc {
+		public:
+			typedef Alloc									allocator_type;
+			typedef T										value_type;
+			typedef T&										reference;
+			typedef const T&								const_reference;
+			typedef	typename allocator_type::pointer		pointer;
+			typedef typename allocator_type::const_pointer	const_pointer;
+			typedef wrap_iter<pointer>						iterator;
+			typedef wrap_iter<const_pointer>				const_iterator;
+			typedef reverse_wrap_iter<iterator>				reverse_iterator;
+			typedef reverse_wrap_iter<const_iterator>		const_reverse_iterator;
+
+			typedef std::size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+
+		private:
+			typedef std::uint32_t	_count;
+
+			pointer _begin;
+			_count _sz;
+			_count _cap;
+
+		public:
+			/* ------------------------------ Constructors ------------------------------ */
+			explicit compact_vector (const allocator_type & alloc = allocator_type())
+				: Alloc(alloc), _begin(nullptr), _sz(0), _cap(0)
+			{}
+			explicit compact_vector (size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type())
+				: Alloc(alloc), _begin(nullptr), _sz(0), _cap(0) {
+				insert(end(), n, val);
+			}
+			template <class InputIterator>
+			compact_vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
+				: Alloc(alloc), _begin(nullptr), _sz(0), _cap(0) {
+				try {
+					for (; first != last; ++first)
+						push_back(*first);
+				} catch (...) {
+					clear();
+					_release();
+					throw;
+				}
+			}
+			compact_vector (const compact_vector& x)
+				: Alloc(x._alloc()), _begin(nullptr), _sz(0), _cap(0) {
+				reserve(x._sz);
+				insert(end(), x.begin(), x.end());
+			}
+			compact_vector (compact_vector&& x) noexcept
+				: Alloc(std::move(x._alloc())), _begin(x._begin), _sz(x._sz), _cap(x._cap) {
+				x._begin = nullptr;
+				x._sz = 0;
+				x._cap = 0;
+			}
+			~compact_vector(void) {
+				clear();
+				_release();
+			}
+			compact_vector & operator=(compact_vector const & rhs) {
+				if (this != &rhs)
+					assign(rhs.begin(), rhs.end());
+				return *this;
+			}
+			compact_vector & operator=(compact_vector&& rhs) noexcept {
+				if (this == &rhs)
+					return *this;
+				clear();
+				_release();
+				this->_alloc() = std::move(rhs._alloc());
+				this->_begin = rhs._begin;
+				this->_sz = rhs._sz;
+				this->_cap = rhs._cap;
+				rhs._begin = nullptr;
+				rhs._sz = 0;
+				rhs._cap = 0;
+				return *this;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Iterators ------------------------------- */
+			iterator	begin(void) {return iterator(this->_begin);}
+			iterator	end(void) {return iterator(this->_begin + this->_sz);}
+			const_iterator begin(void) const {return const_iterator(this->_begin);}
+			const_iterator end(void) const {return const_iterator(this->_begin + this->_sz);}
+			reverse_iterator	rbegin(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(iterator(this->_begin));
+				return reverse_iterator(iterator(this->_begin + this->_sz - 1));
+			}
+			reverse_iterator	rend(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(iterator(this->_begin));
+				return reverse_iterator(iterator(this->_begin - 1));
+			}
+			const_reverse_iterator	rbegin(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(const_iterator(this->_begin));
+				return const_reverse_iterator(const_iterator(this->_begin + this->_sz - 1));
+			}
+			const_reverse_iterator	rend(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(const_iterator(this->_begin));
+				return const_reverse_iterator(const_iterator(this->_begin - 1));
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Capacity -------------------------------- */
+			size_type size(void) const {return this->_sz;}
+			size_type max_size(void) const {
+				size_type limit = std::numeric_limits<_count>::max();
+				return this->_alloc().max_size() < limit ? this->_alloc().max_size() : limit;
+			}
+			size_type capacity(void) const {return this->_cap;}
+			bool empty(void) const {return this->_sz == 0;}
+			void resize(size_type n, value_type val = value_type()) {
+				if (n <= this->_sz)
+					erase(iterator(this->_begin + n), end());
+				else
+					insert(end(), n - this->_sz, val);
+			}
+			void reserve(size_type n) {
+				if (n > this->_cap)
+					_reallocate(n);
+			}
+			void shrink_to_fit(void) {
+				if (this->_cap > this->_sz)
+					_reallocate(this->_sz);
+			}
+			memory_usage_info memory_usage(void) const {
+				return memory_usage_info(this->_sz * sizeof(value_type),
+					(this->_cap - this->_sz) * sizeof(value_type), 0);
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* ----------------------------- Element access ----------------------------- */
+			reference operator[](size_type n) {return this->_begin[n];}
+			const_reference operator[](size_type n) const {return this->_begin[n];}
+			reference at(size_type n) {
+				if (n >= this->_sz)
+					throw compact_vector::Out_of_range();
+				return this->_begin[n];
+			}
+			const_reference at(size_type n) const {
+				if (n >= this->_sz)
+					throw compact_vector::Out_of_range();
+				return this->_begin[n];
+			}
+			reference front(void) {return *this->_begin;}
+			const_reference front(void) const {return *this->_begin;}
+			reference back(void) {return this->_begin[this->_sz - 1];}
+			const_reference back(void) const {return this->_begin[this->_sz - 1];}
+			pointer data(void) {return this->_begin;}
+			const_pointer data(void) const {return this->_begin;}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Modifiers ------------------------------- */
+			template <class InputIterator>
+			void assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				compact_vector save(first, last, this->_alloc());
+				swap(save);
+			}
+			void assign(size_type n, const value_type& val) {
+				value_type save(val);
+				clear();
+				insert(end(), n, save);
+			}
+			template <class InputIterator>
+			void insert (iterator position, InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				_insert_range(position - begin(), first, last,
+					typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+			iterator insert (iterator position, size_type n, const value_type& val) {
+				size_type before = position - begin();
+
+				if (n == 0)
+					return iterator(this->_begin + before);
+				if (_owns(&val)) {
+					value_type save(val);
+					return insert(position, n, save);
+				}
+
+				pointer gap = _open_gap(before, n);
+				size_type built = 0;
+				try {
+					for (; built < n; ++built)
+						this->_alloc().construct(gap + built, val);
+				} catch (...) {
+					_close_gap(before, n, built);
+					throw;
+				}
+				this->_sz += n;
+				return iterator(this->_begin + before);
+			}
+			iterator insert (iterator position, const value_type& val) {return insert(position, 1, val);}
+			iterator insert (iterator position, value_type&& val) {return emplace(position, std::move(val));}
+			template <class... Args>
+			iterator emplace (iterator position, Args&&... args) {
+				size_type before = position - begin();
+
+				if (before == this->_sz && this->_sz < this->_cap) {
+					this->_alloc().construct(this->_begin + this->_sz, std::forward<Args>(args)...);
+					this->_sz++;
+					return iterator(this->_begin + before);
+				}
+
+				value_type tmp(std::forward<Args>(args)...);
+				pointer gap = _open_gap(before, 1);
+				try {
+					this->_alloc().construct(gap, std::move(tmp));
+				} catch (...) {
+					_close_gap(before, 1, 0);
+					throw;
+				}
+				this->_sz++;
+				return iterator(this->_begin + before);
+			}
+			template <class... Args>
+			void emplace_back(Args&&... args) {emplace(end(), std::forward<Args>(args)...);}
+			void push_back(const value_type & val) {insert(end(), val);}
+			void push_back(value_type&& val) {emplace_back(std::move(val));}
+			void pop_back(void) {
+				this->_alloc().destroy(this->_begin + this->_sz - 1);
+				this->_sz--;
+			}
+			void swap(compact_vector& x) {
+				ft::swap(this->_alloc(), x._alloc());
+				ft::swap(this->_begin, x._begin);
+				ft::swap(this->_sz, x._sz);
+				ft::swap(this->_cap, x._cap);
+			}
+			iterator erase(iterator position) {return erase(position, position + 1);}
+			iterator erase(iterator first, iterator last) {
+				size_type start = first - begin();
+				size_type count = last - first;
+
+				for (size_type i = start; i < start + count; i++)
+					this->_alloc().destroy(this->_begin + i);
+				try {
+					ft::relocate_overlapping(this->_alloc(), this->_begin + start + count,
+						this->_sz - start - count, this->_begin + start);
+				} catch (...) {
+					this->_sz = start;
+					throw;
+				}
+				this->_sz -= count;
+				return iterator(this->_begin + start);
+			}
+			void clear(void) {
+				for (size_type i = 0; i < this->_sz; i++)
+					this->_alloc().destroy(this->_begin + i);
+				this->_sz = 0;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Allocator ------------------------------- */
+			allocator_type get_allocator(void) const {return this->_alloc();}
+			/* -------------------------------------------------------------------------- */
+
+		private:
+			/* ----------------------------- Internal helpers ---------------------------- */
+			allocator_type & _alloc(void) {return *this;}
+			allocator_type const & _alloc(void) const {return *this;}
+
+			void _release(void) {
+				if (this->_begin != nullptr)
+					this->_alloc().deallocate(this->_begin, this->_cap);
+				this->_begin = nullptr;
+				this->_cap = 0;
+			}
+			// Moves the elements to a buffer of exactly n; n must be at least size().
+			void _reallocate(size_type n) {
+				if (n > max_size())
+					throw compact_vector::LengthError();
+				pointer new_begin = n ? this->_alloc().allocate(n) : nullptr;
+				try {
+					ft::relocate(this->_alloc(), this->_begin, this->_sz, new_begin);
+				} catch (...) {
+					if (new_begin != nullptr)
+						this->_alloc().deallocate(new_begin, n);
+					throw;
+				}
+				_release();
+				this->_begin = new_begin;
+				this->_cap = static_cast<_count>(n);
+			}
+			// Same contract as ft::vector::_open_gap: n raw slots at index before.
+			pointer _open_gap(size_type before, size_type n) {
+				if (n > max_size() - this->_sz)
+					throw compact_vector::LengthError();
+
+				if (this->_cap < this->_sz + n) {
+					size_type new_cap = static_cast<size_type>(this->_cap) * 2;
+					if (new_cap < this->_sz + n)
+						new_cap = this->_sz + n;
+					if (new_cap > max_size())
+						new_cap = max_size();
+					pointer new_begin = this->_alloc().allocate(new_cap);
+					try {
+						ft::relocate_around(this->_alloc(), this->_begin, this->_sz, new_begin, before, n);
+					} catch (...) {
+						this->_alloc().deallocate(new_begin, new_cap);
+						throw;
+					}
+					_release();
+					this->_begin = new_begin;
+					this->_cap = static_cast<_count>(new_cap);
+					return this->_begin + before;
+				}
+				try {
+					ft::relocate_overlapping(this->_alloc(), this->_begin + before,
+						this->_sz - before, this->_begin + before + n);
+				} catch (...) {
+					this->_sz = before;
+					throw;
+				}
+				return this->_begin + before;
+			}
+			void _close_gap(size_type before, size_type n, size_type built) {
+				for (size_type i = 0; i < built; i++)
+					this->_alloc().destroy(this->_begin + before + i);
+				try {
+					ft::relocate_overlapping(this->_alloc(), this->_begin + before + n,
+						this->_sz - before, this->_begin + before);
+				} catch (...) {
+					this->_sz = before;
+					throw;
+				}
+			}
+			// Input iterators: append at the end, then rotate the new elements into place.
+			template <class InputIterator>
+			void _insert_range(size_type before, InputIterator first, InputIterator last, std::input_iterator_tag) {
+				size_type old_size = this->_sz;
+				try {
+					for (; first != last; ++first)
+						emplace_back(*first);
+				} catch (...) {
+					erase(iterator(this->_begin + old_size), end());
+					throw;
+				}
+				std::rotate(this->_begin + before, this->_begin + old_size, this->_begin + this->_sz);
+			}
+			// Forward iterators: one gap of the right size, filled in place.
+			template <class ForwardIterator>
+			void _insert_range(size_type before, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				if (n == 0)
+					return;
+				// The source lives in our own buffer and would move with the tail
+				if (_aliases(first)) {
+					compact_vector save(first, last, this->_alloc());
+					_insert_range(before, save.begin(), save.end(), std::forward_iterator_tag());
+					return;
+				}
+
+				pointer gap = _open_gap(before, n);
+				size_type built = 0;
+				try {
+					for (; built < n; ++first, ++built)
+						this->_alloc().construct(gap + built, *first);
+				} catch (...) {
+					_close_gap(before, n, built);
+					throw;
+				}
+				this->_sz += n;
+			}
+
+			bool _owns(const_pointer p) const {
+				return !std::less<const_pointer>()(p, this->_begin)
+					&& std::less<const_pointer>()(p, this->_begin + this->_sz);
+			}
+			template <class InputIterator>
+			bool _aliases(InputIterator) const {return false;}
+			template <class P>
+			bool _aliases(wrap_iter<P> it,
+				typename ft::enable_if<std::is_convertible<P, const_pointer>::value>::type* = 0) const {
+				return _owns(it.base());
+			}
+			template <class Iter>
+			bool _aliases(reverse_wrap_iter<Iter> it) const {return _aliases(it.base());}
+			bool _aliases(const_pointer p) const {return _owns(p);}
+			/* -------------------------------------------------------------------------- */
+
+		public:
+		class LengthError: public std::exception {
+			const char* what() const throw() {
+				return "compact_vector";
+			}
+		};
+
+		class Out_of_range : public std::exception {
+			const char*  what() const throw() {
+				return "compact_vector";
+			}
+		};
+	};
+
+	static_assert(sizeof(compact_vector<int>) == sizeof(void *) + 2 * sizeof(std::uint32_t),
+		"compact_vector with a stateless allocator is a pointer and two 32-bit counts");
+
+	template <class T, class Alloc, class Predicate>
+	typename ft::compact_vector<T,Alloc>::size_type erase_if(ft::compact_vector<T,Alloc>& c, Predicate pred) {
+		typename ft::compact_vector<T,Alloc>::iterator it = std::remove_if(c.begin(), c.end(), pred);
+		typename ft::compact_vector<T,Alloc>::size_type erased = c.end() - it;
+
+		c.erase(it, c.end());
+		return erased;
+	}
+
+	template <class T, class Alloc>
+	inline bool operator== (const ft::compact_vector<T,Alloc>& lhs, const ft::compact_vector<T,Alloc>& rhs) {
+		if (lhs.size() == rhs.size())
+			return ft::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+		return false;
+	}
+
+	template <class T, class Alloc>
+	inline bool operator!=(const ft::compact_vector<T,Alloc>& lhs, const ft::compact_vector<T,Alloc>& rhs) {return !(rhs == lhs);}
+
+	template <class T, class Alloc>
+	inline bool operator<(const ft::compact_vector<T,Alloc>& lhs, const ft::compact_vector<T,Alloc>& rhs)
+	{ return ft::lexicographical_compare(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size());}
+
+	template <class T, class Alloc>
+	inline bool operator>  (const ft::compact_vector<T,Alloc>& lhs, const ft::compact_vector<T,Alloc>& rhs) {return rhs < lhs;}
+
+	template <class T, class Alloc>
+	inline bool operator<= (const ft::compact_vector<T,Alloc>& lhs, const ft::compact_vector<T,Alloc>& rhs) {return !(rhs < lhs);}
+
+	template <class T, class Alloc>
+	inline bool operator>= (const ft::compact_vector<T,Alloc>& lhs, const ft::compact_vector<T,Alloc>& rhs) {return !(lhs < rhs);}
+}
+
+#endif
@@ -0,0 +1,323 @@
+#ifndef FT_CONCURRENT_VECTOR_HPP
+# define FT_CONCURRENT_VECTOR_HPP
+
+/* ------------------------------- Explanation ------------------------------ */
+// concurrent_vector<T> is an append-only vector that many threads can push to
+// at once without a lock.
+//	• Storage is a fixed table of segments: segment k holds 32 << k elements,
+//	  so element i lives in segment msb(i + 32) - 5. Segments are never moved
+//	  or freed before the vector dies, so references stay valid while other
+//	  threads keep appending.
+//	• push_back reserves its slot with one atomic fetch_add. The thread that
+//	  takes the first slot of a segment allocates it, and the thread halfway
+//	  through a segment allocates the next one ahead of time. A thread that
+//	  outruns both allocates it itself and the loser of the CAS frees its copy.
+//	• Every slot has a ready flag, set (release) once the element is built.
+//	  size() counts reserved slots; a slot whose push is still running, or
+//	  whose constructor threw, is not ready(). A reader that got an index from
+//	  push_back, or checked ready(i), can use the element right away.
+// Everything else (copy, clear, iteration while pushing) is single-threaded.
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Headers --------------------------------- */
+# include <memory>
+# include <atomic>
+# include <cstddef>
+# include <climits>
+# include <iterator>
+# include <new>
+# include <utility>
+# include "utility.hpp"
+# include "traits.hpp"
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Macroses -------------------------------- */
+// log2 of the size of segment 0.
+# define CONCURRENT_FIRST_SEGMENT_LOG 5
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+
+	/* ------------------------- Concurrent vector iterator ---------------------- */
+	template <class Vector, class T, bool IsConst>
+	class concurrent_vector_iterator {
+		public:
+			typedef std::random_access_iterator_tag									iterator_category;
+			typedef T																value_type;
+			typedef std::ptrdiff_t													difference_type;
+			typedef typename std::conditional<IsConst, const T*, T*>::type			pointer;
+			typedef typename std::conditional<IsConst, const T&, T&>::type			reference;
+			typedef typename std::conditional<IsConst, const Vector*, Vector*>::type	container;
+			typedef concurrent_vector_iterator<Vector, T, IsConst>					this_type;
+
+			concurrent_vector_iterator(void) : _vec(nullptr), _pos(0) {}
+			concurrent_vector_iterator(container vec, difference_type pos) : _vec(vec), _pos(pos) {}
+			template <bool C>
+			concurrent_vector_iterator(concurrent_vector_iterator<Vector, T, C> const & x,
+				typename ft::enable_if<IsConst && !C>::type* = 0) : _vec(x.vec()), _pos(x.pos()) {}
+
+			reference operator*(void) const {return (*this->_vec)[this->_pos];}
+			pointer operator->(void) const {return &**this;}
+			reference operator[](difference_type n) const {return (*this->_vec)[this->_pos + n];}
+			this_type & operator++(void) {++this->_pos; return *this;}
+			this_type operator++(int) {this_type tmp(*this); ++this->_pos; return tmp;}
+			this_type & operator--(void) {--this->_pos; return *this;}
+			this_type operator--(int) {this_type tmp(*this); --this->_pos; return tmp;}
+			this_type & operator+=(difference_type n) {this->_pos += n; return *this;}
+			this_type & operator-=(difference_type n) {this->_pos -= n; return *this;}
+			this_type operator+(difference_type n) const {return this_type(this->_vec, this->_pos + n);}
+			this_type operator-(difference_type n) const {return this_type(this->_vec, this->_pos - n);}
+
+			container vec(void) const {return this->_vec;}
+			difference_type pos(void) const {return this->_pos;}
+
+		private:
+			container _vec;
+			difference_type _pos;
+	};
+
+	# define CV_ITER_TEMPLATE template<class V, class T, bool C1, bool C2>
+	# define CV_ITER_LHS concurrent_vector_iterator<V, T, C1>
+	# define CV_ITER_RHS concurrent_vector_iterator<V, T, C2>
+
+	CV_ITER_TEMPLATE
+	inline std::ptrdiff_t operator-(CV_ITER_LHS const & lhs, CV_ITER_RHS const & rhs) {return lhs.pos() - rhs.pos();}
+	CV_ITER_TEMPLATE
+	inline bool operator==(CV_ITER_LHS const & lhs, CV_ITER_RHS const & rhs) {return lhs.pos() == rhs.pos();}
+	CV_ITER_TEMPLATE
+	inline bool operator!=(CV_ITER_LHS const & lhs, CV_ITER_RHS const & rhs) {return lhs.pos() != rhs.pos();}
+	CV_ITER_TEMPLATE
+	inline bool operator<(CV_ITER_LHS const & lhs, CV_ITER_RHS const & rhs) {return lhs.pos() < rhs.pos();}
+	CV_ITER_TEMPLATE
+	inline bool operator>(CV_ITER_LHS const & lhs, CV_ITER_RHS const & rhs) {return lhs.pos() > rhs.pos();}
+	CV_ITER_TEMPLATE
+	inline bool operator<=(CV_ITER_LHS const & lhs, CV_ITER_RHS const & rhs) {return lhs.pos() <= rhs.pos();}
+	CV_ITER_TEMPLATE
+	inline bool operator>=(CV_ITER_LHS const & lhs, CV_ITER_RHS const & rhs) {return lhs.pos() >= rhs.pos();}
+	/* -------------------------------------------------------------------------- */
+
+	template <typename T, typename Alloc = std::allocator<T> >
+	class concurrent_vector {
+		public:
+			typedef T										value_type;
+			typedef Alloc									allocator_type;
+			typedef T&										reference;
+			typedef const T&								const_reference;
+			typedef typename allocator_type::pointer		pointer;
+			typedef typename allocator_type::const_pointer	const_pointer;
+			typedef std::size_t								size_type;
+			typedef std::ptrdiff_t							difference_type;
+			typedef concurrent_vector_iterator<concurrent_vector, T, false>	iterator;
+			typedef concurrent_vector_iterator<concurrent_vector, T, true>		const_iterator;
+
+			static const size_type first_segment = size_type(1) << CONCURRENT_FIRST_SEGMENT_LOG;
+			static const size_type max_segments = sizeof(size_type) * CHAR_BIT - CONCURRENT_FIRST_SEGMENT_LOG;
+
+		private:
+			typedef std::atomic<unsigned char>								_flag;
+			typedef typename Alloc::template rebind<char>::other			byte_allocator;
+
+			// A segment is one block: its elements, then one ready flag per element.
+			std::atomic<char *> _segments[max_segments];
+			std::atomic<size_type> _sz;
+			allocator_type _alloc;
+			byte_allocator _alloc_bytes;
+
+		public:
+			/* ------------------------------ Constructors ------------------------------ */
+			explicit concurrent_vector (const allocator_type & alloc = allocator_type())
+				: _sz(0), _alloc(alloc), _alloc_bytes(alloc) {
+				for (size_type k = 0; k < max_segments; k++)
+					this->_segments[k].store(nullptr, std::memory_order_relaxed);
+			}
+			concurrent_vector (const concurrent_vector& x)
+				: _sz(0), _alloc(x._alloc), _alloc_bytes(x._alloc_bytes) {
+				for (size_type k = 0; k < max_segments; k++)
+					this->_segments[k].store(nullptr, std::memory_order_relaxed);
+				try {
+					for (size_type i = 0; i < x.size(); i++)
+						if (x.ready(i))
+							push_back(x[i]);
+				} catch (...) {
+					_release();
+					throw;
+				}
+			}
+			~concurrent_vector(void) {_release();}
+			concurrent_vector & operator=(concurrent_vector const & rhs) {
+				if (this != &rhs) {
+					concurrent_vector tmp(rhs);
+					swap(tmp);
+				}
+				return *this;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Iterators ------------------------------- */
+			iterator begin(void) {return iterator(this, 0);}
+			iterator end(void) {return iterator(this, size());}
+			const_iterator begin(void) const {return const_iterator(this, 0);}
+			const_iterator end(void) const {return const_iterator(this, size());}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Capacity -------------------------------- */
+			// Reserved slots, including pushes that have not finished yet.
+			size_type size(void) const {return this->_sz.load(std::memory_order_acquire);}
+			size_type max_size(void) const {return this->_alloc.max_size();}
+			bool empty(void) const {return size() == 0;}
+			size_type capacity(void) const {
+				size_type cap = 0;
+				for (size_type k = 0; k < max_segments; k++)
+					if (this->_segments[k].load(std::memory_order_acquire) != nullptr)
+						cap += _segment_size(k);
+				return cap;
+			}
+			// Allocates the segments covering the first n slots; safe to call while pushing.
+			void reserve(size_type n) {
+				if (n > max_size())
+					throw concurrent_vector::LengthError();
+				for (size_type k = 0; n != 0 && k <= _segment_of(n - 1); k++)
+					_ensure_segment(k);
+			}
+			// True once element i is fully built and visible to this thread.
+			bool ready(size_type i) const {
+				if (i >= size())
+					return false;
+				char *seg = this->_segments[_segment_of(i)].load(std::memory_order_acquire);
+				return seg != nullptr
+					&& _flags(seg, _segment_of(i))[_offset(i)].load(std::memory_order_acquire) != 0;
+			}
+			memory_usage_info memory_usage(void) const {
+				size_type n = size();
+				return memory_usage_info(n * sizeof(value_type), (capacity() - n) * sizeof(value_type),
+					capacity() * sizeof(_flag));
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* ----------------------------- Element access ----------------------------- */
+			reference operator[](size_type i) {return _elements(_segment(i))[_offset(i)];}
+			const_reference operator[](size_type i) const {return _elements(_segment(i))[_offset(i)];}
+			reference at(size_type i) {
+				if (!ready(i))
+					throw concurrent_vector::Out_of_range();
+				return (*this)[i];
+			}
+			const_reference at(size_type i) const {
+				if (!ready(i))
+					throw concurrent_vector::Out_of_range();
+				return (*this)[i];
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Modifiers ------------------------------- */
+			// Thread-safe. Returns the index of the new element.
+			template <class... Args>
+			size_type emplace_back(Args&&... args) {
+				size_type i = this->_sz.fetch_add(1, std::memory_order_acq_rel);
+				size_type k = _segment_of(i);
+				size_type off = _offset(i);
+
+				if (i >= max_size())
+					throw concurrent_vector::LengthError();
+				char *seg = _ensure_segment(k);
+				if (off == _segment_size(k) / 2 && k + 1 < max_segments)
+					_ensure_segment(k + 1);
+				this->_alloc.construct(_elements(seg) + off, std::forward<Args>(args)...);
+				_flags(seg, k)[off].store(1, std::memory_order_release);
+				return i;
+			}
+			size_type push_back(const value_type & val) {return emplace_back(val);}
+			size_type push_back(value_type&& val) {return emplace_back(std::move(val));}
+			// Not thread-safe: no push may run concurrently.
+			void clear(void) {
+				size_type n = size();
+				for (size_type i = 0; i < n; i++)
+					if (ready(i)) {
+						this->_alloc.destroy(&(*this)[i]);
+						_flags(_segment(i), _segment_of(i))[_offset(i)].store(0, std::memory_order_relaxed);
+					}
+				this->_sz.store(0, std::memory_order_release);
+			}
+			// Not thread-safe.
+			void swap(concurrent_vector& x) {
+				for (size_type k = 0; k < max_segments; k++) {
+					char *seg = this->_segments[k].load(std::memory_order_relaxed);
+					this->_segments[k].store(x._segments[k].load(std::memory_order_relaxed), std::memory_order_relaxed);
+					x._segments[k].store(seg, std::memory_order_relaxed);
+				}
+				size_type sz = this->_sz.load(std::memory_order_relaxed);
+				this->_sz.store(x._sz.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				x._sz.store(sz, std::memory_order_relaxed);
+				ft::swap(this->_alloc, x._alloc);
+				ft::swap(this->_alloc_bytes, x._alloc_bytes);
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Allocator ------------------------------- */
+			allocator_type get_allocator(void) const {return this->_alloc;}
+			/* -------------------------------------------------------------------------- */
+
+		private:
+			/* ----------------------------- Internal helpers ---------------------------- */
+			static size_type _msb(size_type x) {return sizeof(size_type) * CHAR_BIT - 1 - __builtin_clzll(x);}
+			// The OR keeps msb defined (and the index in range) for the compiler; it never changes the result.
+			static size_type _segment_of(size_type i) {return _msb((i + first_segment) | first_segment) - CONCURRENT_FIRST_SEGMENT_LOG;}
+			static size_type _offset(size_type i) {
+				size_type j = i + first_segment;
+				return j - (size_type(1) << _msb(j));
+			}
+			static size_type _segment_size(size_type k) {return first_segment << k;}
+			static size_type _segment_bytes(size_type k) {
+				return _segment_size(k) * (sizeof(value_type) + sizeof(_flag));
+			}
+			static pointer _elements(char *seg) {return reinterpret_cast<pointer>(seg);}
+			static _flag *_flags(char *seg, size_type k) {
+				return reinterpret_cast<_flag *>(seg + _segment_size(k) * sizeof(value_type));
+			}
+			char *_segment(size_type i) const {
+				return this->_segments[_segment_of(i)].load(std::memory_order_acquire);
+			}
+			// Returns segment k, allocating it if nobody has yet.
+			char *_ensure_segment(size_type k) {
+				char *seg = this->_segments[k].load(std::memory_order_acquire);
+				if (seg != nullptr)
+					return seg;
+
+				char *fresh = this->_alloc_bytes.allocate(_segment_bytes(k));
+				_flag *flags = _flags(fresh, k);
+				for (size_type i = 0; i < _segment_size(k); i++)
+					::new (static_cast<void *>(flags + i)) _flag(0);
+				if (this->_segments[k].compare_exchange_strong(seg, fresh, std::memory_order_acq_rel))
+					return fresh;
+				this->_alloc_bytes.deallocate(fresh, _segment_bytes(k));
+				return seg;
+			}
+			void _release(void) {
+				clear();
+				for (size_type k = 0; k < max_segments; k++) {
+					char *seg = this->_segments[k].load(std::memory_order_relaxed);
+					if (seg != nullptr)
+						this->_alloc_bytes.deallocate(seg, _segment_bytes(k));
+					this->_segments[k].store(nullptr, std::memory_order_relaxed);
+				}
+			}
+			/* -------------------------------------------------------------------------- */
+
+			static_assert(alignof(T) <= alignof(std::max_align_t), "concurrent_vector: over-aligned value_type");
+
+		public:
+		class LengthError: public std::exception {
+			const char* what() const throw() {
+				return "concurrent_vector";
+			}
+		};
+
+		class Out_of_range : public std::exception {
+			const char*  what() const throw() {
+				return "concurrent_vector";
+			}
+		};
+	};
+}
+
+#endif
@@ -0,0 +1,515 @@
+#ifndef FT_DEQUE_HPP
+# define FT_DEQUE_HPP
+
+/* ------------------------------- Explanation ------------------------------ */
+// deque stores its elements in fixed-size chunks and keeps a map: an array of
+// pointers to the chunks. Element i lives at absolute position _start + i,
+// that is in chunk (_start + i) / chunk_size at slot (_start + i) % chunk_size.
+//	• push/pop at either end is O(1): at worst a chunk is allocated or freed;
+//	• elements never move when the deque grows, only chunk pointers do when
+//	  the map itself is full, so references stay valid and no push ever copies
+//	  what is already stored;
+//	• the map grows geometrically and is recentred when one end runs out of
+//	  room, so a deque used as a queue does not keep growing its map.
+// One empty chunk is kept at each end, so pushing and popping across a chunk
+// boundary does not allocate and free the same chunk over and over.
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Headers --------------------------------- */
+# include <memory>
+# include <limits>
+# include <algorithm>
+# include <iterator>
+# include <cstring>
+# include <utility>
+# include "utility.hpp"
+# include "traits.hpp"
+# include "reverse_iterator.hpp"
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Macroses -------------------------------- */
+// Target chunk size in bytes; a chunk always holds at least 16 elements.
+# define DEQUE_CHUNK_BYTES 4096
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+
+	/* ----------------------------- Deque iterator ----------------------------- */
+	template <class T, std::size_t ChunkSize, bool IsConst>
+	class deque_iterator {
+		public:
+			typedef std::random_access_iterator_tag									iterator_category;
+			typedef T																value_type;
+			typedef std::ptrdiff_t													difference_type;
+			typedef typename std::conditional<IsConst, const T*, T*>::type			pointer;
+			typedef typename std::conditional<IsConst, const T&, T&>::type			reference;
+			typedef deque_iterator<T, ChunkSize, IsConst>							this_type;
+
+			deque_iterator(void) : _map(nullptr), _pos(0) {}
+			deque_iterator(T * const *map, difference_type pos) : _map(map), _pos(pos) {}
+			// iterator -> const_iterator
+			template <bool C>
+			deque_iterator(deque_iterator<T, ChunkSize, C> const & x,
+				typename ft::enable_if<IsConst && !C>::type* = 0) : _map(x.map()), _pos(x.pos()) {}
+
+			reference operator*(void) const {return this->_map[this->_pos / ChunkSize][this->_pos % ChunkSize];}
+			pointer operator->(void) const {return &**this;}
+			reference operator[](difference_type n) const {return *(*this + n);}
+			this_type & operator++(void) {++this->_pos; return *this;}
+			this_type operator++(int) {this_type tmp(*this); ++this->_pos; return tmp;}
+			this_type & operator--(void) {--this->_pos; return *this;}
+			this_type operator--(int) {this_type tmp(*this); --this->_pos; return tmp;}
+			this_type & operator+=(difference_type n) {this->_pos += n; return *this;}
+			this_type & operator-=(difference_type n) {this->_pos -= n; return *this;}
+			this_type operator+(difference_type n) const {return this_type(this->_map, this->_pos + n);}
+			this_type operator-(difference_type n) const {return this_type(this->_map, this->_pos - n);}
+
+			T * const *map(void) const {return this->_map;}
+			difference_type pos(void) const {return this->_pos;}
+
+		private:
+			T * const *_map;
+			difference_type _pos;
+	};
+
+	# define DEQUE_ITER_TEMPLATE template<class T, std::size_t C, bool C1, bool C2>
+	# define DEQUE_ITER_LHS deque_iterator<T, C, C1>
+	# define DEQUE_ITER_RHS deque_iterator<T, C, C2>
+
+	DEQUE_ITER_TEMPLATE
+	inline std::ptrdiff_t operator-(DEQUE_ITER_LHS const & lhs, DEQUE_ITER_RHS const & rhs) {return lhs.pos() - rhs.pos();}
+	DEQUE_ITER_TEMPLATE
+	inline bool operator==(DEQUE_ITER_LHS const & lhs, DEQUE_ITER_RHS const & rhs) {return lhs.pos() == rhs.pos();}
+	DEQUE_ITER_TEMPLATE
+	inline bool operator!=(DEQUE_ITER_LHS const & lhs, DEQUE_ITER_RHS const & rhs) {return lhs.pos() != rhs.pos();}
+	DEQUE_ITER_TEMPLATE
+	inline bool operator<(DEQUE_ITER_LHS const & lhs, DEQUE_ITER_RHS const & rhs) {return lhs.pos() < rhs.pos();}
+	DEQUE_ITER_TEMPLATE
+	inline bool operator>(DEQUE_ITER_LHS const & lhs, DEQUE_ITER_RHS const & rhs) {return lhs.pos() > rhs.pos();}
+	DEQUE_ITER_TEMPLATE
+	inline bool operator<=(DEQUE_ITER_LHS const & lhs, DEQUE_ITER_RHS const & rhs) {return lhs.pos() <= rhs.pos();}
+	DEQUE_ITER_TEMPLATE
+	inline bool operator>=(DEQUE_ITER_LHS const & lhs, DEQUE_ITER_RHS const & rhs) {return lhs.pos() >= rhs.pos();}
+
+	template <class T, std::size_t C, bool IsConst>
+	inline deque_iterator<T, C, IsConst> operator+(std::ptrdiff_t n, deque_iterator<T, C, IsConst> const & it) {return it + n;}
+	/* -------------------------------------------------------------------------- */
+
+	template <typename T, typename Alloc = std::allocator<T> >
+	class deque {
+		private:
+			static constexpr std::size_t _pow2_ceil(std::size_t n, std::size_t p = 1) {
+				return p >= n ? p : _pow2_ceil(n, p * 2);
+			}
+		public:
+			typedef T										value_type;
+			typedef Alloc									allocator_type;
+			typedef T&										reference;
+			typedef const T&								const_reference;
+			typedef typename allocator_type::pointer		pointer;
+			typedef typename allocator_type::const_pointer	const_pointer;
+			typedef std::size_t								size_type;
+			typedef std::ptrdiff_t							difference_type;
+
+			// Elements per chunk: a power of two, so positions split with a shift and a mask.
+			static const size_type chunk_size = _pow2_ceil(sizeof(T)) * 16 >= DEQUE_CHUNK_BYTES
+				? 16 : DEQUE_CHUNK_BYTES / _pow2_ceil(sizeof(T));
+
+			typedef deque_iterator<T, chunk_size, false>	iterator;
+			typedef deque_iterator<T, chunk_size, true>		const_iterator;
+			typedef reverse_wrap_iter<iterator>				reverse_iterator;
+			typedef reverse_wrap_iter<const_iterator>		const_reverse_iterator;
+
+		private:
+			typedef typename Alloc::template rebind<pointer>::other	map_allocator;
+
+			pointer *_map;
+			size_type _map_cap;
+			size_type _start;		// absolute position of the first element
+			size_type _sz;
+			size_type _chunks;		// allocated chunks
+			allocator_type _alloc;
+			map_allocator _alloc_map;
+
+		public:
+			/* ------------------------------ Constructors ------------------------------ */
+			explicit deque (const allocator_type & alloc = allocator_type())
+				: _map(nullptr), _map_cap(0), _start(0), _sz(0), _chunks(0), _alloc(alloc), _alloc_map(alloc)
+			{}
+			explicit deque (size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type())
+				: _map(nullptr), _map_cap(0), _start(0), _sz(0), _chunks(0), _alloc(alloc), _alloc_map(alloc) {
+				try {
+					for (; this->_sz < n;)
+						push_back(val);
+				} catch (...) {
+					_release();
+					throw;
+				}
+			}
+			template <class InputIterator>
+			deque (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
+				: _map(nullptr), _map_cap(0), _start(0), _sz(0), _chunks(0), _alloc(alloc), _alloc_map(alloc) {
+				try {
+					for (; first != last; ++first)
+						push_back(*first);
+				} catch (...) {
+					_release();
+					throw;
+				}
+			}
+			deque (const deque& x)
+				: _map(nullptr), _map_cap(0), _start(0), _sz(0), _chunks(0), _alloc(x._alloc), _alloc_map(x._alloc_map) {
+				try {
+					for (const_iterator it = x.begin(); it != x.end(); ++it)
+						push_back(*it);
+				} catch (...) {
+					_release();
+					throw;
+				}
+			}
+			deque (deque&& x) noexcept
+				: _map(x._map), _map_cap(x._map_cap), _start(x._start), _sz(x._sz), _chunks(x._chunks),
+				_alloc(std::move(x._alloc)), _alloc_map(std::move(x._alloc_map)) {
+				x._map = nullptr;
+				x._map_cap = 0;
+				x._start = 0;
+				x._sz = 0;
+				x._chunks = 0;
+			}
+			~deque(void) {_release();}
+			deque & operator=(deque const & rhs) {
+				if (this != &rhs)
+					assign(rhs.begin(), rhs.end());
+				return *this;
+			}
+			deque & operator=(deque&& rhs) noexcept {
+				swap(rhs);
+				return *this;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Iterators ------------------------------- */
+			iterator	begin(void) {return iterator(this->_map, this->_start);}
+			iterator	end(void) {return iterator(this->_map, this->_start + this->_sz);}
+			const_iterator begin(void) const {return const_iterator(this->_map, this->_start);}
+			const_iterator end(void) const {return const_iterator(this->_map, this->_start + this->_sz);}
+			reverse_iterator	rbegin(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(begin());
+				return reverse_iterator(end() - 1);
+			}
+			reverse_iterator	rend(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(begin());
+				return reverse_iterator(begin() - 1);
+			}
+			const_reverse_iterator	rbegin(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(begin());
+				return const_reverse_iterator(end() - 1);
+			}
+			const_reverse_iterator	rend(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(begin());
+				return const_reverse_iterator(begin() - 1);
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Capacity -------------------------------- */
+			size_type size(void) const {return this->_sz;}
+			size_type max_size(void) const {return this->_alloc.max_size();}
+			bool empty(void) const {return this->_sz == 0;}
+			void resize(size_type n, value_type val = value_type()) {
+				while (this->_sz > n)
+					pop_back();
+				while (this->_sz < n)
+					push_back(val);
+			}
+			// Frees the spare chunks at both ends.
+			void shrink_to_fit(void) {
+				for (size_type i = 0; i < this->_map_cap; i++)
+					if (this->_map[i] != nullptr && !_in_use(i))
+						_free_chunk(i);
+			}
+			memory_usage_info memory_usage(void) const {
+				return memory_usage_info(this->_sz * sizeof(value_type),
+					(this->_chunks * chunk_size - this->_sz) * sizeof(value_type),
+					this->_map_cap * sizeof(pointer));
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* ----------------------------- Element access ----------------------------- */
+			reference operator[](size_type n) {return _at(this->_start + n);}
+			const_reference operator[](size_type n) const {return _at(this->_start + n);}
+			reference at(size_type n) {
+				if (n >= this->_sz)
+					throw deque::Out_of_range();
+				return (*this)[n];
+			}
+			const_reference at(size_type n) const {
+				if (n >= this->_sz)
+					throw deque::Out_of_range();
+				return (*this)[n];
+			}
+			reference front(void) {return _at(this->_start);}
+			const_reference front(void) const {return _at(this->_start);}
+			reference back(void) {return _at(this->_start + this->_sz - 1);}
+			const_reference back(void) const {return _at(this->_start + this->_sz - 1);}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Modifiers ------------------------------- */
+			// Assigns over the live elements, then pushes or pops the difference.
+			template <class InputIterator>
+			void assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				size_type i = 0;
+				for (; i < this->_sz && first != last; ++i, ++first)
+					(*this)[i] = *first;
+				while (this->_sz > i)
+					pop_back();
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			void assign(size_type n, const value_type& val) {
+				value_type save(val);
+				size_type common = n < this->_sz ? n : this->_sz;
+				for (size_type i = 0; i < common; i++)
+					(*this)[i] = save;
+				resize(n, save);
+			}
+			template <class... Args>
+			void emplace_back(Args&&... args) {
+				if (this->_map == nullptr || (this->_start + this->_sz) / chunk_size >= this->_map_cap)
+					_make_room();
+				size_type pos = this->_start + this->_sz;
+				_ensure_chunk(pos / chunk_size);
+				this->_alloc.construct(&_at(pos), std::forward<Args>(args)...);
+				this->_sz++;
+			}
+			template <class... Args>
+			void emplace_front(Args&&... args) {
+				if (this->_start == 0)
+					_make_room();
+				size_type pos = this->_start - 1;
+				_ensure_chunk(pos / chunk_size);
+				this->_alloc.construct(&_at(pos), std::forward<Args>(args)...);
+				this->_start--;
+				this->_sz++;
+			}
+			void push_back(const value_type & val) {emplace_back(val);}
+			void push_back(value_type&& val) {emplace_back(std::move(val));}
+			void push_front(const value_type & val) {emplace_front(val);}
+			void push_front(value_type&& val) {emplace_front(std::move(val));}
+			void pop_back(void) {
+				size_type pos = this->_start + this->_sz - 1;
+				this->_alloc.destroy(&_at(pos));
+				this->_sz--;
+				// The chunk at pos is empty now: keep it as the spare, free the one after
+				if (pos % chunk_size == 0 && pos / chunk_size + 1 < this->_map_cap)
+					_free_chunk(pos / chunk_size + 1);
+			}
+			void pop_front(void) {
+				size_type pos = this->_start;
+				this->_alloc.destroy(&_at(pos));
+				this->_start++;
+				this->_sz--;
+				// The chunk at pos is empty now: keep it as the spare, free the one before
+				if (this->_start % chunk_size == 0 && pos / chunk_size >= 1)
+					_free_chunk(pos / chunk_size - 1);
+			}
+			// Middle inserts go to the nearer end and are rotated into place.
+			iterator insert(iterator position, const value_type& val) {
+				size_type before = position - begin();
+				value_type save(val);
+
+				if (before < this->_sz / 2) {
+					emplace_front(std::move(save));
+					std::rotate(begin(), begin() + 1, begin() + before + 1);
+				} else {
+					emplace_back(std::move(save));
+					std::rotate(begin() + before, end() - 1, end());
+				}
+				return begin() + before;
+			}
+			iterator insert(iterator position, size_type n, const value_type& val) {
+				size_type before = position - begin();
+				value_type save(val);
+				size_type old_size = this->_sz;
+
+				try {
+					for (size_type i = 0; i < n; i++)
+						push_back(save);
+				} catch (...) {
+					while (this->_sz > old_size)
+						pop_back();
+					throw;
+				}
+				std::rotate(begin() + before, begin() + old_size, end());
+				return begin() + before;
+			}
+			template <class InputIterator>
+			void insert(iterator position, InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				size_type before = position - begin();
+				size_type old_size = this->_sz;
+
+				try {
+					for (; first != last; ++first)
+						push_back(*first);
+				} catch (...) {
+					while (this->_sz > old_size)
+						pop_back();
+					throw;
+				}
+				std::rotate(begin() + before, begin() + old_size, end());
+			}
+			iterator erase(iterator position) {return erase(position, position + 1);}
+			// Closes the hole from the shorter side.
+			iterator erase(iterator first, iterator last) {
+				size_type before = first - begin();
+				size_type count = last - first;
+				size_type after = this->_sz - before - count;
+
+				if (count == 0)
+					return first;
+				if (before < after) {
+					std::move_backward(begin(), first, last);
+					for (size_type i = 0; i < count; i++)
+						pop_front();
+				} else {
+					std::move(last, end(), first);
+					for (size_type i = 0; i < count; i++)
+						pop_back();
+				}
+				return begin() + before;
+			}
+			void swap(deque& x) {
+				ft::swap(this->_map, x._map);
+				ft::swap(this->_map_cap, x._map_cap);
+				ft::swap(this->_start, x._start);
+				ft::swap(this->_sz, x._sz);
+				ft::swap(this->_chunks, x._chunks);
+				ft::swap(this->_alloc, x._alloc);
+				ft::swap(this->_alloc_map, x._alloc_map);
+			}
+			void clear(void) {
+				while (this->_sz != 0)
+					pop_back();
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Allocator ------------------------------- */
+			allocator_type get_allocator(void) const {return this->_alloc;}
+			/* -------------------------------------------------------------------------- */
+
+		private:
+			/* ----------------------------- Internal helpers ---------------------------- */
+			reference _at(size_type pos) const {return this->_map[pos / chunk_size][pos % chunk_size];}
+			bool _in_use(size_type chunk) const {
+				return this->_sz != 0 && chunk >= this->_start / chunk_size
+					&& chunk <= (this->_start + this->_sz - 1) / chunk_size;
+			}
+			void _ensure_chunk(size_type chunk) {
+				if (this->_map[chunk] == nullptr) {
+					this->_map[chunk] = this->_alloc.allocate(chunk_size);
+					this->_chunks++;
+				}
+			}
+			void _free_chunk(size_type chunk) {
+				if (this->_map[chunk] != nullptr) {
+					this->_alloc.deallocate(this->_map[chunk], chunk_size);
+					this->_map[chunk] = nullptr;
+					this->_chunks--;
+				}
+			}
+			// Called when one end has no free map slot. Allocated chunks only exist in
+			// [first used - 1, last used + 1]; that window is moved to the middle of the
+			// map, which is doubled first if the window fills more than half of it.
+			void _make_room(void) {
+				size_type lo = this->_start / chunk_size;
+				if (lo != 0)
+					lo--;
+				size_type hi = (this->_start + this->_sz) / chunk_size + 2;
+				if (hi > this->_map_cap)
+					hi = this->_map_cap;
+				size_type span = hi > lo ? hi - lo : 0;
+
+				size_type new_cap = this->_map_cap;
+				if (span * 2 + 2 > new_cap)
+					new_cap = new_cap * 2 > 8 ? new_cap * 2 : 8;
+				if (new_cap > this->_alloc_map.max_size())
+					throw deque::LengthError();
+				size_type new_lo = (new_cap - span) / 2;
+
+				if (new_cap == this->_map_cap) {
+					std::memmove(static_cast<void *>(this->_map + new_lo), static_cast<void *>(this->_map + lo),
+						span * sizeof(pointer));
+					for (size_type i = 0; i < new_cap; i++)
+						if (i < new_lo || i >= new_lo + span)
+							this->_map[i] = nullptr;
+				} else {
+					pointer *fresh = this->_alloc_map.allocate(new_cap);
+					for (size_type i = 0; i < new_cap; i++)
+						fresh[i] = nullptr;
+					for (size_type i = 0; i < span; i++)
+						fresh[new_lo + i] = this->_map[lo + i];
+					if (this->_map != nullptr)
+						this->_alloc_map.deallocate(this->_map, this->_map_cap);
+					this->_map = fresh;
+					this->_map_cap = new_cap;
+				}
+				this->_start = this->_start - lo * chunk_size + new_lo * chunk_size;
+			}
+			void _release(void) {
+				clear();
+				for (size_type i = 0; i < this->_map_cap; i++)
+					_free_chunk(i);
+				if (this->_map != nullptr)
+					this->_alloc_map.deallocate(this->_map, this->_map_cap);
+				this->_map = nullptr;
+				this->_map_cap = 0;
+				this->_start = 0;
+			}
+			/* -------------------------------------------------------------------------- */
+
+		public:
+		class LengthError: public std::exception {
+			const char* what() const throw() {
+				return "deque";
+			}
+		};
+
+		class Out_of_range : public std::exception {
+			const char*  what() const throw() {
+				return "deque";
+			}
+		};
+	};
+
+	template <class T, class Alloc>
+	inline bool operator== (const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs) {
+		if (lhs.size() == rhs.size())
+			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+		return false;
+	}
+
+	template <class T, class Alloc>
+	inline bool operator!=(const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs) {return !(rhs == lhs);}
+
+	template <class T, class Alloc>
+	inline bool operator<(const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs)
+	{ return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());}
+
+	template <class T, class Alloc>
+	inline bool operator>  (const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs) {return rhs < lhs;}
+
+	template <class T, class Alloc>
+	inline bool operator<= (const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs) {return !(rhs < lhs);}
+
+	template <class T, class Alloc>
+	inline bool operator>= (const ft::deque<T,Alloc>& lhs, const ft::deque<T,Alloc>& rhs) {return !(lhs < rhs);}
+}
+
+#endif
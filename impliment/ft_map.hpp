@@ -24,6 +24,11 @@
 // by combining various cases in a natural way.
 // 
 // This LLRB tree model is described by Robert Sedgewick.
+//
+// Every insert allocates a node and a value separately, so the allocator is on
+// the hot path. For maps that churn, ft::pool_allocator (pool_allocator.hpp)
+// serves both from per-thread free lists:
+//	ft::map<Key, T, ft::less<Key>, ft::pool_allocator<std::pair<const Key, T> > >
 /* -------------------------------------------------------------------------- */
 
 /* -------------------------------- Macroses -------------------------------- */
@@ -552,7 +557,7 @@ namespace ft {
 		public:
 		/**** Constructor ****/
 		explicit map (const key_compare& comp = key_compare(),
-					  const allocator_type& alloc = allocator_type()) : _root(nullptr), _size(0), _allocData(alloc), _comp(comp) {
+					  const allocator_type& alloc = allocator_type()) : _root(nullptr), _size(0), _allocNode(alloc), _allocData(alloc), _comp(comp) {
 			_createTheoreticalNodes();
 		};
 
@@ -560,14 +565,25 @@ namespace ft {
 		map (InputIterator first, InputIterator last,
 			 const key_compare& comp = key_compare(),
 			 const allocator_type& alloc = allocator_type(),
-			 typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) : _root(nullptr), _size(0), _allocData(alloc), _comp(comp) {
+			 typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) : _root(nullptr), _size(0), _allocNode(alloc), _allocData(alloc), _comp(comp) {
 			_createTheoreticalNodes();
 			for (; first != last; first++) {
 				this->insert(*first);
 			}
 		 };
 
-		map (const map& node) : _root(nullptr), _size(0) {
+		map (const map& node) : _root(nullptr), _size(0), _allocNode(node._allocNode), _allocData(node._allocData), _comp(node._comp) {
+			_createTheoreticalNodes();
+			*this = node;
+		};
+
+		// Allocator-extended constructors, used when the map is itself an element
+		// of a container built on polymorphic_allocator.
+		explicit map (const allocator_type& alloc) : _root(nullptr), _size(0), _allocNode(alloc), _allocData(alloc), _comp() {
+			_createTheoreticalNodes();
+		};
+
+		map (const map& node, const allocator_type& alloc) : _root(nullptr), _size(0), _allocNode(alloc), _allocData(alloc), _comp(node._comp) {
 			_createTheoreticalNodes();
 			*this = node;
 		};
@@ -609,6 +625,11 @@ namespace ft {
 		bool empty() const { return (_size == 0); };
 		size_type size() const { return this->_size; };
 		size_type max_size() const { return std::numeric_limits<size_type>::max() / sizeof(_tNode); };
+		// Every element lives in its own node; the two sentinel nodes are overhead too.
+		memory_usage_info memory_usage() const {
+			return memory_usage_info(_size * sizeof(value_type), 0,
+				_size * sizeof(_tNode) + 2 * (sizeof(_tNode) + sizeof(value_type)));
+		};
 
 		/****  Element access ****/
 		mapped_type& operator[] (const key_type& k) {
@@ -742,8 +763,15 @@ namespace ft {
 			size_t tmpSize = _size;
 			_size = x._size;
 			x._size = tmpSize;
+
+			ft::swap(_allocNode, x._allocNode);
+			ft::swap(_allocData, x._allocData);
+			ft::swap(_comp, x._comp);
 		};
 
+		/**** Allocator ****/
+		allocator_type get_allocator() const { return _allocData; };
+
 		/**** Observers ****/
 		key_compare key_comp() const { return _comp; };
 		value_compare value_comp() const { return value_compare(_comp); };
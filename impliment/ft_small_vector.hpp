@@ -0,0 +1,522 @@
+#ifndef FT_SMALL_VECTOR_HPP
+# define FT_SMALL_VECTOR_HPP
+
+/* ------------------------------- Explanation ------------------------------ */
+// small_vector<T, N> is a vector that keeps its first N elements inside the
+// object itself. It only goes to the allocator once it grows past N, so short
+// per-request vectors cost no heap allocation at all.
+// The interface and the iterators (wrap_iter) are the ones of ft::vector.
+// Unlike ft::vector, moving a small_vector whose elements are still inline
+// moves the elements one by one, and it never gives inline storage back to
+// a heap buffer that has been allocated.
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Headers --------------------------------- */
+# include <memory>
+# include <algorithm>
+# include <cstring>
+# include <functional>
+# include <iterator>
+# include <limits>
+# include <utility>
+# include <type_traits>
+# include "utility.hpp"
+# include "iterator.hpp"
+# include "reverse_iterator.hpp"
+# include "relocate.hpp"
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+
+	template <typename T, std::size_t N, typename Alloc = std::allocator<T> >
+	class small_vector {
+		public:
+			typedef Alloc									allocator_type;
+			typedef T										value_type;
+			typedef T&										reference;
+			typedef const T&								const_reference;
+			typedef	typename allocator_type::pointer		pointer;
+			typedef typename allocator_type::const_pointer	const_pointer;
+			typedef wrap_iter<pointer>						iterator;
+			typedef wrap_iter<const_pointer>				const_iterator;
+			typedef reverse_wrap_iter<iterator>				reverse_iterator;
+			typedef reverse_wrap_iter<const_iterator>		const_reverse_iterator;
+
+			typedef std::size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+
+			static const size_type inline_capacity = N;
+
+		private:
+			pointer _begin;
+			size_type _cap;
+			size_type _sz;
+			allocator_type _alloc;
+			typename std::aligned_storage<sizeof(T) * (N ? N : 1), alignof(T)>::type _inline;
+
+		public:
+			/* ------------------------------ Constructors ------------------------------ */
+			explicit small_vector (const allocator_type & alloc = allocator_type())
+				: _begin(_inline_begin()), _cap(N), _sz(0), _alloc(alloc)
+			{}
+			explicit small_vector (size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type())
+				: _begin(_inline_begin()), _cap(N), _sz(0), _alloc(alloc) {
+				insert(end(), n, val);
+			}
+			template <class InputIterator>
+			small_vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
+				: _begin(_inline_begin()), _cap(N), _sz(0), _alloc(alloc) {
+				insert(end(), first, last);
+			}
+			small_vector (const small_vector& x)
+				: _begin(_inline_begin()), _cap(N), _sz(0), _alloc(x._alloc) {
+				insert(end(), x.begin(), x.end());
+			}
+			small_vector (small_vector&& x)
+				: _begin(_inline_begin()), _cap(N), _sz(0), _alloc(std::move(x._alloc)) {
+				_steal(x);
+			}
+			~small_vector(void) {
+				clear();
+				_release();
+			}
+			small_vector & operator=(small_vector const & rhs) {
+				if (this != &rhs)
+					assign(rhs.begin(), rhs.end());
+				return *this;
+			}
+			small_vector & operator=(small_vector&& rhs) {
+				if (this == &rhs)
+					return *this;
+				clear();
+				_release();
+				_steal(rhs);
+				return *this;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Iterators ------------------------------- */
+			iterator	begin(void) {return iterator(this->_begin);}
+			iterator	end(void) {return iterator(this->_begin + this->_sz);}
+			const_iterator begin(void) const {return const_iterator(this->_begin);}
+			const_iterator end(void) const {return const_iterator(this->_begin + this->_sz);}
+			reverse_iterator	rbegin(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(iterator(this->_begin));
+				return reverse_iterator(iterator(this->_begin + this->_sz - 1));
+			}
+			reverse_iterator	rend(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(iterator(this->_begin));
+				return reverse_iterator(iterator(this->_begin - 1));
+			}
+			const_reverse_iterator	rbegin(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(const_iterator(this->_begin));
+				return const_reverse_iterator(const_iterator(this->_begin + this->_sz - 1));
+			}
+			const_reverse_iterator	rend(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(const_iterator(this->_begin));
+				return const_reverse_iterator(const_iterator(this->_begin - 1));
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Capacity -------------------------------- */
+			size_type size(void) const {return this->_sz;}
+			size_type max_size(void) const {return this->_alloc.max_size();}
+			size_type capacity(void) const {return this->_cap;}
+			bool empty(void) const {return this->_sz == 0;}
+			// True while the elements still live in the inline slots.
+			bool is_inline(void) const {return this->_begin == _inline_begin();}
+			void resize(size_type n, value_type val = value_type()) {
+				if (n <= this->_sz)
+					erase(iterator(this->_begin + n), end());
+				else
+					insert(end(), n - this->_sz, val);
+			}
+			void reserve(size_type n) {
+				if (n > this->_cap)
+					_grow_to(n);
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* ----------------------------- Element access ----------------------------- */
+			reference operator[](size_type n) {return this->_begin[n];}
+			const_reference operator[](size_type n) const {return this->_begin[n];}
+			reference at(size_type n) {
+				if (n >= this->_sz)
+					throw small_vector::Out_of_range();
+				return this->_begin[n];
+			}
+			const_reference at(size_type n) const {
+				if (n >= this->_sz)
+					throw small_vector::Out_of_range();
+				return this->_begin[n];
+			}
+			reference front(void) {return *this->_begin;}
+			const_reference front(void) const {return *this->_begin;}
+			reference back(void) {return this->_begin[this->_sz - 1];}
+			const_reference back(void) const {return this->_begin[this->_sz - 1];}
+			pointer data(void) {return this->_begin;}
+			const_pointer data(void) const {return this->_begin;}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Modifiers ------------------------------- */
+			template <class InputIterator>
+			void assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				_assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+			// Reuses the inline or heap buffer when n fits, as ft::vector does.
+			void assign(size_type n, const value_type& val) {
+				if (_owns(&val)) {
+					value_type save(val);
+					return assign(n, save);
+				}
+				if (n > this->_cap) {
+					clear();
+					insert(end(), n, val);
+					return;
+				}
+				std::fill_n(this->_begin, n < this->_sz ? n : this->_sz, val);
+				if (n > this->_sz)
+					insert(end(), n - this->_sz, val);
+				else
+					erase(iterator(this->_begin + n), end());
+			}
+			template <class InputIterator>
+			void insert (iterator position, InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				_insert_range(position - begin(), first, last,
+					typename ft::iterator_traits<InputIterator>::iterator_category());
+			}
+			iterator insert (iterator position, size_type n, const value_type& val) {
+				size_type before = position - begin();
+
+				if (n == 0)
+					return iterator(this->_begin + before);
+				if (_owns(&val)) {
+					value_type save(val);
+					return insert(position, n, save);
+				}
+
+				pointer gap = _open_gap(before, n);
+				size_type built = 0;
+				try {
+					for (; built < n; ++built)
+						this->_alloc.construct(gap + built, val);
+				} catch (...) {
+					_close_gap(before, n, built);
+					throw;
+				}
+				this->_sz += n;
+				return iterator(this->_begin + before);
+			}
+			iterator insert (iterator position, const value_type& val) {return insert(position, 1, val);}
+			iterator insert (iterator position, value_type&& val) {return emplace(position, std::move(val));}
+			template <class... Args>
+			iterator emplace (iterator position, Args&&... args) {
+				size_type before = position - begin();
+
+				if (before == this->_sz && this->_sz < this->_cap) {
+					this->_alloc.construct(this->_begin + this->_sz, std::forward<Args>(args)...);
+					this->_sz++;
+					return iterator(this->_begin + before);
+				}
+
+				value_type tmp(std::forward<Args>(args)...);
+				pointer gap = _open_gap(before, 1);
+				try {
+					this->_alloc.construct(gap, std::move(tmp));
+				} catch (...) {
+					_close_gap(before, 1, 0);
+					throw;
+				}
+				this->_sz++;
+				return iterator(this->_begin + before);
+			}
+			template <class... Args>
+			void emplace_back(Args&&... args) {emplace(end(), std::forward<Args>(args)...);}
+			void push_back(const value_type & val) {insert(end(), val);}
+			void push_back(value_type&& val) {emplace_back(std::move(val));}
+			void pop_back(void) {
+				this->_alloc.destroy(this->_begin + this->_sz - 1);
+				this->_sz--;
+			}
+			void swap(small_vector& x) {
+				small_vector tmp(std::move(x));
+				x = std::move(*this);
+				*this = std::move(tmp);
+			}
+			iterator erase(iterator position) {return erase(position, position + 1);}
+			iterator erase(iterator first, iterator last) {
+				size_type start = first - begin();
+				size_type count = last - first;
+
+				for (size_type i = start; i < start + count; i++)
+					this->_alloc.destroy(this->_begin + i);
+				try {
+					ft::relocate_overlapping(this->_alloc, this->_begin + start + count,
+						this->_sz - start - count, this->_begin + start);
+				} catch (...) {
+					this->_sz = start;
+					throw;
+				}
+				this->_sz -= count;
+				return iterator(this->_begin + start);
+			}
+			void clear(void) {
+				for (size_type i = 0; i < this->_sz; i++)
+					this->_alloc.destroy(this->_begin + i);
+				this->_sz = 0;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Allocator ------------------------------- */
+			allocator_type get_allocator(void) const {return this->_alloc;}
+			/* -------------------------------------------------------------------------- */
+
+		private:
+			/* ----------------------------- Internal helpers ---------------------------- */
+			pointer _inline_begin(void) {return reinterpret_cast<pointer>(&this->_inline);}
+			const_pointer _inline_begin(void) const {return reinterpret_cast<const_pointer>(&this->_inline);}
+
+			// Frees the heap buffer, if any, and falls back to the inline slots.
+			void _release(void) {
+				if (!is_inline())
+					this->_alloc.deallocate(this->_begin, this->_cap);
+				this->_begin = _inline_begin();
+				this->_cap = N;
+			}
+			// Takes over x's elements and leaves x empty. *this must be empty and inline.
+			void _steal(small_vector& x) {
+				if (x.is_inline()) {
+					ft::relocate(this->_alloc, x._begin, x._sz, this->_begin);
+				} else {
+					this->_begin = x._begin;
+					this->_cap = x._cap;
+					x._begin = x._inline_begin();
+					x._cap = N;
+				}
+				this->_sz = x._sz;
+				x._sz = 0;
+			}
+			void _grow_to(size_type new_cap) {
+				if (new_cap > max_size())
+					throw small_vector::LengthError();
+				pointer new_begin = this->_alloc.allocate(new_cap);
+				try {
+					ft::relocate(this->_alloc, this->_begin, this->_sz, new_begin);
+				} catch (...) {
+					this->_alloc.deallocate(new_begin, new_cap);
+					throw;
+				}
+				_release();
+				this->_begin = new_begin;
+				this->_cap = new_cap;
+			}
+			// Same contract as ft::vector::_open_gap: n raw slots at index before.
+			pointer _open_gap(size_type before, size_type n) {
+				if (n > max_size() - this->_sz)
+					throw small_vector::LengthError();
+
+				if (this->_cap < this->_sz + n) {
+					size_type new_cap = this->_cap * 2;
+					if (new_cap < this->_sz + n)
+						new_cap = this->_sz + n;
+					if (new_cap > max_size())
+						new_cap = max_size();
+					pointer new_begin = this->_alloc.allocate(new_cap);
+					try {
+						ft::relocate_around(this->_alloc, this->_begin, this->_sz, new_begin, before, n);
+					} catch (...) {
+						this->_alloc.deallocate(new_begin, new_cap);
+						throw;
+					}
+					_release();
+					this->_begin = new_begin;
+					this->_cap = new_cap;
+					return this->_begin + before;
+				}
+				try {
+					ft::relocate_overlapping(this->_alloc, this->_begin + before,
+						this->_sz - before, this->_begin + before + n);
+				} catch (...) {
+					this->_sz = before;
+					throw;
+				}
+				return this->_begin + before;
+			}
+			void _close_gap(size_type before, size_type n, size_type built) {
+				for (size_type i = 0; i < built; i++)
+					this->_alloc.destroy(this->_begin + before + i);
+				try {
+					ft::relocate_overlapping(this->_alloc, this->_begin + before + n,
+						this->_sz - before, this->_begin + before);
+				} catch (...) {
+					this->_sz = before;
+					throw;
+				}
+			}
+			// Input iterators: assign over the live elements, then append or erase the rest.
+			template <class InputIterator>
+			void _assign_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
+				size_type i = 0;
+				for (; i < this->_sz && first != last; ++i, ++first)
+					this->_begin[i] = *first;
+				if (first == last) {
+					erase(iterator(this->_begin + i), end());
+					return;
+				}
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+			// Forward iterators: the size is known, so the buffer is reused when it fits
+			// and replaced by one of exactly n otherwise.
+			template <class ForwardIterator>
+			void _assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				if (n > max_size())
+					throw small_vector::LengthError();
+				// The source lives in our own buffer and could be overwritten before it is read
+				if (_aliases(first)) {
+					small_vector save(first, last, this->_alloc);
+					_assign_range(save.begin(), save.end(), std::forward_iterator_tag());
+					return;
+				}
+				if (n > this->_cap) {
+					pointer fresh = this->_alloc.allocate(n);
+					size_type built = 0;
+					try {
+						for (; built < n; ++built, ++first)
+							this->_alloc.construct(fresh + built, *first);
+					} catch (...) {
+						while (built != 0)
+							this->_alloc.destroy(fresh + --built);
+						this->_alloc.deallocate(fresh, n);
+						throw;
+					}
+					clear();
+					_release();
+					this->_begin = fresh;
+					this->_cap = n;
+					this->_sz = n;
+					return;
+				}
+				size_type i = 0;
+				for (; i < n && i < this->_sz; ++i, ++first)
+					this->_begin[i] = *first;
+				for (; i < n; ++i, ++first) {
+					this->_alloc.construct(this->_begin + i, *first);
+					this->_sz = i + 1;
+				}
+				erase(iterator(this->_begin + n), end());
+			}
+
+			// Input iterators: append at the end, then rotate the new elements into place.
+			template <class InputIterator>
+			void _insert_range(size_type before, InputIterator first, InputIterator last, std::input_iterator_tag) {
+				size_type old_size = this->_sz;
+				try {
+					for (; first != last; ++first)
+						emplace_back(*first);
+				} catch (...) {
+					erase(iterator(this->_begin + old_size), end());
+					throw;
+				}
+				std::rotate(this->_begin + before, this->_begin + old_size, this->_begin + this->_sz);
+			}
+			// Forward iterators: one gap of the right size, filled in place.
+			template <class ForwardIterator>
+			void _insert_range(size_type before, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				if (n == 0)
+					return;
+				// The source lives in our own buffer and would move with the tail
+				if (_aliases(first)) {
+					small_vector save(first, last, this->_alloc);
+					_insert_range(before, save.begin(), save.end(), std::forward_iterator_tag());
+					return;
+				}
+
+				pointer gap = _open_gap(before, n);
+				size_type built = 0;
+				try {
+					for (; built < n; ++first, ++built)
+						this->_alloc.construct(gap + built, *first);
+				} catch (...) {
+					_close_gap(before, n, built);
+					throw;
+				}
+				this->_sz += n;
+			}
+
+			bool _owns(const_pointer p) const {
+				return !std::less<const_pointer>()(p, this->_begin)
+					&& std::less<const_pointer>()(p, this->_begin + this->_sz);
+			}
+			template <class InputIterator>
+			bool _aliases(InputIterator) const {return false;}
+			template <class P>
+			bool _aliases(wrap_iter<P> it,
+				typename ft::enable_if<std::is_convertible<P, const_pointer>::value>::type* = 0) const {
+				return _owns(it.base());
+			}
+			template <class Iter>
+			bool _aliases(reverse_wrap_iter<Iter> it) const {return _aliases(it.base());}
+			bool _aliases(const_pointer p) const {return _owns(p);}
+			/* -------------------------------------------------------------------------- */
+
+		public:
+		class LengthError: public std::exception {
+			const char* what() const throw() {
+				return "small_vector";
+			}
+		};
+
+		class Out_of_range : public std::exception {
+			const char*  what() const throw() {
+				return "small_vector";
+			}
+		};
+	};
+
+	template <class T, std::size_t N, class Alloc, class Predicate>
+	typename ft::small_vector<T,N,Alloc>::size_type erase_if(ft::small_vector<T,N,Alloc>& c, Predicate pred) {
+		typename ft::small_vector<T,N,Alloc>::iterator it = std::remove_if(c.begin(), c.end(), pred);
+		typename ft::small_vector<T,N,Alloc>::size_type erased = c.end() - it;
+
+		c.erase(it, c.end());
+		return erased;
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	inline bool operator== (const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs) {
+		if (lhs.size() == rhs.size())
+			return ft::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+		return false;
+	}
+
+	template <class T, std::size_t N, class Alloc>
+	inline bool operator!=(const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs) {return !(rhs == lhs);}
+
+	template <class T, std::size_t N, class Alloc>
+	inline bool operator<(const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs)
+	{ return ft::lexicographical_compare(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size());}
+
+	template <class T, std::size_t N, class Alloc>
+	inline bool operator>  (const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs) {return rhs < lhs;}
+
+	template <class T, std::size_t N, class Alloc>
+	inline bool operator<= (const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs) {return !(rhs < lhs);}
+
+	template <class T, std::size_t N, class Alloc>
+	inline bool operator>= (const ft::small_vector<T,N,Alloc>& lhs, const ft::small_vector<T,N,Alloc>& rhs) {return !(lhs < rhs);}
+}
+
+#endif
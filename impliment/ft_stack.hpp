@@ -3,10 +3,11 @@
 
 /* --------------------------------- Headers -------------------------------- */
 # include "ft_vector.hpp"
+# include "ft_deque.hpp"
 /* -------------------------------------------------------------------------- */
 
 namespace ft {
-	template <typename T, class Container = ft::vector<T>, typename Alloc = std::allocator<T> >
+	template <typename T, class Container = ft::deque<T>, typename Alloc = std::allocator<T> >
 	class stack {
 		public:
 			typedef T               value_type;
@@ -24,6 +25,8 @@ namespace ft {
 
 			size_t size() const { return cont.size(); }
 
+			memory_usage_info memory_usage() const { return cont.memory_usage(); }
+
 			void push(const value_type &val) { cont.push_back(val); }
 
 			value_type &top() { return cont.back(); }
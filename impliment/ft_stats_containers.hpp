@@ -0,0 +1,44 @@
+#ifndef FT_STATS_CONTAINERS_HPP
+# define FT_STATS_CONTAINERS_HPP
+
+// ft::stats::vector, map, deque and stack: the ft containers with a
+// stats_allocator for default allocator instead of std::allocator, one set
+// of counters per container and element type (ft::vector_alloc_tag<int>,
+// ft::map_alloc_tag<...>, ...). They are aliases, so an explicit allocator
+// still wins and ft::stats::vector<int> is a plain ft::vector.
+//
+// The ft containers' own defaults never change: instrumenting is opt-in,
+// per declaration. The tests pick these aliases in their -DFT_ALLOC_STATS
+// build, see testing.hpp.
+
+/* --------------------------------- Headers -------------------------------- */
+# include "ft_vector.hpp"
+# include "ft_map.hpp"
+# include "ft_deque.hpp"
+# include "ft_stack.hpp"
+# include "stats_allocator.hpp"
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+	template <class T> struct vector_alloc_tag {};
+	template <class T> struct map_alloc_tag {};
+	template <class T> struct deque_alloc_tag {};
+
+	namespace stats {
+		template <class T, class Alloc = ft::stats_allocator<T, ft::vector_alloc_tag<T> >,
+			class GrowthPolicy = ft::double_growth>
+		using vector = ft::vector<T, Alloc, GrowthPolicy>;
+
+		template <class Key, class T, class Compare = ft::less<Key>,
+			class Alloc = ft::stats_allocator<std::pair<const Key, T>, ft::map_alloc_tag<std::pair<const Key, T> > > >
+		using map = ft::map<Key, T, Compare, Alloc>;
+
+		template <class T, class Alloc = ft::stats_allocator<T, ft::deque_alloc_tag<T> > >
+		using deque = ft::deque<T, Alloc>;
+
+		template <class T, class Container = ft::stats::deque<T>, class Alloc = std::allocator<T> >
+		using stack = ft::stack<T, Container, Alloc>;
+	}
+}
+
+#endif
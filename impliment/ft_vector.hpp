@@ -12,21 +12,25 @@
 # include <algorithm>
 # include <cstring>
 # include <climits>
+# include <functional>
+# include <utility>
 # include <__debug>
 # include "utility.hpp"
 # include "iterator.hpp"
 # include "reverse_iterator.hpp"
+# include "relocate.hpp"
+# include "growth_policy.hpp"
+# include "parallel.hpp"
 /* -------------------------------------------------------------------------- */
 
 /* ------------------------------ FT Namespace ------------------------------ */
 namespace ft {
 
-	template <typename T, typename Alloc = std::allocator<T> >
+	template <typename T, typename Alloc = std::allocator<T>, typename GrowthPolicy = ft::double_growth>
 	class vector {
-		private:
-			typedef Alloc									allocator_type;
 		public:
 			// Name requirements for c++ container:
+			typedef Alloc									allocator_type;
 			typedef T										value_type;
 			typedef T&										reference;
 			typedef const T&								const_reference;
@@ -38,7 +42,11 @@ namespace ft {
 			typedef reverse_wrap_iter<const_iterator>		const_reverse_iterator;
 
 			typedef std::size_t size_type;
-			typedef signed int difference_type;
+			typedef std::ptrdiff_t difference_type;
+		private:
+			typedef ft::allocator_alignment<allocator_type, T>	_data_alignment;
+			typedef std::allocator_traits<allocator_type>		_alloc_traits;
+		public:
 
 			pointer _begin;
 			allocator_type 	_alloc;
@@ -65,27 +73,53 @@ namespace ft {
 			template <class InputIterator>
 			explicit vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
 				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
-				: _alloc(alloc), _cap(last - first), _sz(last - first) {
-				difference_type diff = last - first;
-				try {
-					this->_begin = this->_alloc.allocate(diff);
-				} catch(const std::exception& e) {
-					this->~vector();
-					throw vector::LengthError();
-				}
-				for (difference_type i = 0; i < diff; i++)
-					this->_alloc.construct(this->_begin + i, *(first + i));
+				: _begin(nullptr), _alloc(alloc), _cap(EMPTY), _sz(EMPTY) {
+				_init_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 			}
-			explicit vector (const vector& x)
-				: _begin(nullptr), _alloc(x._alloc), _cap(x._cap), _sz(x._sz) {
-				try {
-					this->_begin = this->_alloc.allocate(x._cap);
-				} catch(std::exception & e) {
-					this->~vector();
-					throw vector::LengthError();
-				}
-				for (size_type i = 0; i < x._sz; i++)
-					this->_alloc.construct(this->_begin + i, x[i]);
+			vector (const vector& x)
+				: _begin(nullptr), _alloc(x._alloc), _cap(EMPTY), _sz(EMPTY) {
+				_init_range(x._begin, x._begin + x._sz, std::random_access_iterator_tag());
+			}
+			// Allocator-extended copy and move: what a container built on
+			// polymorphic_allocator uses to hand its resource to nested vectors.
+			vector (const vector& x, const allocator_type& alloc)
+				: _begin(nullptr), _alloc(alloc), _cap(EMPTY), _sz(EMPTY) {
+				_init_range(x._begin, x._begin + x._sz, std::random_access_iterator_tag());
+			}
+			// Steals the buffer only when alloc can free it; otherwise moves element by element.
+			vector (vector&& x, const allocator_type& alloc)
+				: _begin(nullptr), _alloc(alloc), _cap(EMPTY), _sz(EMPTY) {
+				if (this->_alloc == x._alloc) {
+					this->_begin = x._begin;
+					this->_cap = x._cap;
+					this->_sz = x._sz;
+					x._begin = nullptr;
+					x._cap = 0;
+					x._sz = 0;
+				} else
+					_init_range(std::make_move_iterator(x._begin), std::make_move_iterator(x._begin + x._sz),
+						std::random_access_iterator_tag());
+			}
+			// Parallel versions of the fill and copy constructors, see parallel.hpp.
+			vector (parallel_policy policy, size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type())
+				: _begin(nullptr), _alloc(alloc), _cap(EMPTY), _sz(EMPTY) {
+				_init_parallel(policy, n, [&val](allocator_type & a, pointer p, size_type) {
+					a.construct(p, val);
+				});
+			}
+			vector (parallel_policy policy, const vector& x)
+				: _begin(nullptr), _alloc(x._alloc), _cap(EMPTY), _sz(EMPTY) {
+				const_pointer src = x._begin;
+				_init_parallel(policy, x._sz, [src](allocator_type & a, pointer p, size_type i) {
+					a.construct(p, src[i]);
+				});
+			}
+			vector (vector&& x) noexcept
+				: _begin(x._begin), _alloc(std::move(x._alloc)), _cap(x._cap), _sz(x._sz) {
+				x._begin = nullptr;
+				x._cap = 0;
+				x._sz = 0;
 			}
 			virtual ~vector(void) {
 				if (this->_begin == nullptr)
@@ -97,16 +131,21 @@ namespace ft {
 				this->_cap = 0;
 				this->_begin = nullptr;
 			}
-			vector const & operator=(vector const & rhs) {
+			// Keeps the buffer when it is big enough: a scratch vector assigned in a
+			// loop stops allocating once it has seen its largest source.
+			vector & operator=(vector const & rhs) {
 				if (this == &rhs)
 					return *this;
-				this->~vector();
-				this->_alloc = rhs.get_allocator();
-				this->_begin = this->_alloc.allocate(rhs.capacity());
-				for (size_type i = 0; i < rhs.size(); i++)
-					this->_alloc.construct(this->_begin + i, rhs[i]);
-				this->_cap = rhs.capacity();
-				this->_sz = rhs.size();
+				_assign_range(rhs._begin, rhs._begin + rhs._sz, std::random_access_iterator_tag());
+				return *this;
+			}
+			// The allocator comes along only when it propagates on move assignment
+			// (a polymorphic_allocator never does). Otherwise the buffer is taken when
+			// our allocator can free it, and the elements are moved one by one when not.
+			vector & operator=(vector&& rhs) noexcept(_alloc_traits::propagate_on_container_move_assignment::value) {
+				if (this == &rhs)
+					return *this;
+				_move_assign(rhs, integral_constant<bool, _alloc_traits::propagate_on_container_move_assignment::value>());
 				return *this;
 			}
 
@@ -150,18 +189,33 @@ namespace ft {
 				else
 					insert(iterator(this->_begin + this->_sz), n - this->_sz , val);
 			}
+			// Like resize(n), but new elements are left uninitialized: for buffers
+			// that are about to be overwritten (read(2), memcpy, decoders).
+			void resize_default_init(size_type n) {
+				static_assert(std::is_trivially_default_constructible<value_type>::value
+					&& std::is_trivially_destructible<value_type>::value,
+					"resize_default_init needs a trivial value_type");
+				if (n > this->_sz)
+					_open_gap(this->_sz, n - this->_sz);
+				this->_sz = n;
+			}
 			void reserve(size_type n) {
 				if (n > this->_cap) {
-					pointer new_begin = this->_alloc.allocate(n);
-					
-					memmove(new_begin,this->_begin, sizeof(value_type) * this->_sz);
-					if (this->_begin != 0) {
-						this->_alloc.deallocate(this->_begin, this->_sz);
-					}
-					this->_cap = n;
-					this->_begin = new_begin;
+					if (n > max_size())
+						throw vector::LengthError();
+					_reallocate(n);
 				}
 			}
+			// Gives the slack back: the buffer is reallocated to exactly size() elements.
+			void shrink_to_fit(void) {
+				if (this->_cap > this->_sz)
+					_reallocate(this->_sz);
+			}
+			// Heap bytes held by the vector itself (what the elements own is not counted).
+			memory_usage_info memory_usage(void) const {
+				return memory_usage_info(this->_sz * sizeof(value_type),
+					(this->_cap - this->_sz) * sizeof(value_type), 0);
+			}
 			/* -------------------------------------------------------------------------- */
 
 			/* ----------------------------- Element access ----------------------------- */
@@ -193,97 +247,96 @@ namespace ft {
 			const_reference back(void) const {
 				return *(this->_begin + (this->_sz - 1));
 			}
+			// The buffer, promised to the compiler as aligned to what the allocator
+			// guarantees (see allocator_alignment), so kernels over it can use
+			// aligned vector loads without a peeling loop.
+			pointer data(void) {
+				return static_cast<pointer>(__builtin_assume_aligned(this->_begin, _data_alignment::value));
+			}
+			const_pointer data(void) const {
+				return static_cast<const_pointer>(__builtin_assume_aligned(this->_begin, _data_alignment::value));
+			}
 			/* -------------------------------------------------------------------------- */
 
 			/* -------------------------------- Modifiers ------------------------------- */
 			template <class InputIterator>
 			void assign(InputIterator first, InputIterator last, 
 				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) { // range
-				difference_type diff = last - first;
-
-				if (diff < 0) {
-					this->~vector();
-					throw vector::LengthError();
-				}
-
-				vector save(first, last);
-
-				clear();
-				reserve(diff);
-				insert(begin(), save.begin(), save.end());
-				this->_sz = diff;
+				_assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 			}
 			void assign(size_type n, const value_type& val) { // fill
-				value_type save(val);
-				clear();
-				reserve(n);
-				insert(begin(), n, save);
-			}
-			template <class InputIterator>
-			void insert (iterator position, InputIterator first, InputIterator last, 
-			typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
-				difference_type diff = last - first;
-				difference_type before = position - begin();
-
-				// Incorrect iterators as arguments
-				if (diff <= 0) {
+				if (n > this->_cap) {
+					vector fresh(n, val, this->_alloc);
+					swap(fresh);
 					return;
 				}
-
-				// if true - add new elements(without allocation)
-				if (this->_cap >= this->_sz + diff) {
-					while (first != last) {
-						insert(position, *first);
-						first++;
-						position++;
-					}
+				if (_owns(&val)) {
+					value_type save(val);
+					return assign(n, save);
+				}
+				std::fill_n(this->_begin, n < this->_sz ? n : this->_sz, val);
+				size_type i = this->_sz;
+				try {
+					for (; i < n; ++i)
+						this->_alloc.construct(this->_begin + i, val);
+				} catch (...) {
+					this->_sz = i;
+					throw;
+				}
+				for (; i > n; --i)
+					this->_alloc.destroy(this->_begin + i - 1);
+				this->_sz = n;
+			}
+			void assign(parallel_policy policy, size_type n, const value_type& val) {
+				if (n > this->_cap) {
+					vector fresh(policy, n, val, this->_alloc);
+					swap(fresh);
 					return;
 				}
-
-				// else - allocate new memory
-				size_t new_cap = this->_cap * 2;
-				if (this->_sz + diff > new_cap) {
-					new_cap = this->_sz + diff;
+				if (_owns(&val)) {
+					value_type save(val);
+					return assign(policy, n, save);
 				}
-
-				pointer new_begin = this->_alloc.allocate(new_cap);
-
-				memmove(new_begin, this->_begin, sizeof(value_type) * before);
-				iterator new_position(new_begin + before);
-
-				for (; first != last; ++first, (void) ++new_position)
-					*new_position = *first;
-				memmove(new_begin + before + diff, this->_begin + before, sizeof(value_type) * (this->_sz - before));
-				if (this->_begin != 0) {
-					this->_alloc.deallocate(this->_begin, this->_cap);
+				pointer begin = this->_begin;
+				ft::parallel_for(policy, begin, n < this->_sz ? n : this->_sz,
+					[begin, &val](size_type lo, size_type hi) {std::fill(begin + lo, begin + hi, val);},
+					[](size_type, size_type) {});
+				if (n > this->_sz) {
+					ft::parallel_construct(policy, this->_alloc, begin + this->_sz, n - this->_sz,
+						[&val](allocator_type & a, pointer p, size_type) {a.construct(p, val);});
 				}
-
-				this->_sz += diff;
-				this->_begin = new_begin;
-				this->_cap = new_cap;
+				for (size_type i = this->_sz; i > n; --i)
+					this->_alloc.destroy(begin + i - 1);
+				this->_sz = n;
+			}
+			template <class InputIterator>
+			void insert (iterator position, InputIterator first, InputIterator last, 
+			typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				_insert_range(position - begin(), first, last,
+					typename ft::iterator_traits<InputIterator>::iterator_category());
 			}
 			iterator insert (iterator position, size_type n, const value_type& val) {
 				size_type before = position - begin();
 
-				if (this->_cap >= this->_sz + n) {
-					size_type last = (this->_sz == 0) ? 0 : this->_sz - 1;
-
-					for(size_type i = before; i < this->_sz; i++, last--)
-						memmove(this->_begin + last + n, this->_begin + last, sizeof(value_type));
-					
-					for(size_type i = 0; i < n; i++) 
-						this->_alloc.construct(this->_begin + before + i, val);
-					this->_sz += n;
+				if (n == 0)
 					return iterator(this->_begin + before);
+
+				// val may be one of our own elements, which the gap would move
+				if (_owns(&val)) {
+					value_type save(val);
+					return insert(position, n, save);
+				}
+
+				pointer gap = _open_gap(before, n);
+				size_type built = 0;
+				try {
+					for (; built < n; ++built)
+						this->_alloc.construct(gap + built, val);
+				} catch (...) {
+					_close_gap(before, n, built);
+					throw;
 				}
-				size_type new_cap = this->_cap * 2;
-				
-				if (new_cap < this->_sz + n)
-					new_cap = this->_sz + n;
-				difference_type save_pos(position - begin());
-
-				reserve(new_cap);
-				insert(iterator(this->_begin + save_pos), n, val);
+				this->_sz += n;
 				return iterator(this->_begin + before);
 			}
 			iterator insert (iterator position, const value_type& val) {
@@ -291,15 +344,43 @@ namespace ft {
 				insert(position, 1, val);
 				return iterator(this->_begin + before);
 			}
+			iterator insert (iterator position, value_type&& val) {return emplace(position, std::move(val));}
+			template <class... Args>
+			iterator emplace (iterator position, Args&&... args) {
+				size_type before = position - begin();
+
+				if (before == this->_sz && this->_sz < this->_cap) {
+					this->_alloc.construct(this->_begin + this->_sz, std::forward<Args>(args)...);
+					this->_sz++;
+					return iterator(this->_begin + before);
+				}
+
+				// args may refer to our own elements, build the value before anything moves
+				value_type tmp(std::forward<Args>(args)...);
+				pointer gap = _open_gap(before, 1);
+				try {
+					this->_alloc.construct(gap, std::move(tmp));
+				} catch (...) {
+					_close_gap(before, 1, 0);
+					throw;
+				}
+				this->_sz++;
+				return iterator(this->_begin + before);
+			}
+			template <class... Args>
+			void emplace_back(Args&&... args) {emplace(end(), std::forward<Args>(args)...);}
 			void push_back(const value_type & val) {insert(end(), val);}
+			void push_back(value_type&& val) {emplace_back(std::move(val));}
 			void pop_back(void) {
 				_LIBCPP_ASSERT(!empty(), "vector::pop_back called for empty vector");
 				this->_alloc.destroy(this->_begin + this->_sz - 1);
 				this->_sz--;
 			}
+			// The allocators are exchanged only when they propagate on swap; if they
+			// do not, they must compare equal, as for std::vector.
 			void swap(vector& x) {
 				ft::swap(this->_begin, x._begin);
-				ft::swap(this->_alloc, x._alloc);
+				_swap_alloc(x, integral_constant<bool, _alloc_traits::propagate_on_container_swap::value>());
 				ft::swap(this->_sz, x._sz);
 				ft::swap(this->_cap, x._cap);
 			}
@@ -308,19 +389,25 @@ namespace ft {
 
 				if (this->_sz == 0)
 					return iterator(this->_begin + index);
-
-				this->_alloc.destroy(this->_begin + index);
-				this->_sz--;
-				std::memmove(this->_begin + index, this->_begin + index + 1, sizeof(value_type) * (this->_sz - index));
-				return iterator(this->_begin + index);
+				return erase(position, position + 1);
 			}
 			iterator erase(iterator first, iterator last) {
 				size_type start = first - begin();
+				size_type count = last - first;
 
-				while (first != last) {
-					erase(first);
-					--last;
+				if (count == 0)
+					return iterator(this->_begin + start);
+
+				for (size_type i = start; i < start + count; i++)
+					this->_alloc.destroy(this->_begin + i);
+				try {
+					ft::relocate_overlapping(this->_alloc, this->_begin + start + count,
+						this->_sz - start - count, this->_begin + start);
+				} catch (...) {
+					this->_sz = start;
+					throw;
 				}
+				this->_sz -= count;
 				return iterator(this->_begin + start);
 			}
 			void clear(void) {
@@ -336,6 +423,303 @@ namespace ft {
 			allocator_type get_allocator(void) const {return this->_alloc;}
 			/* -------------------------------------------------------------------------- */
 
+		private:
+			/* ----------------------------- Internal helpers ---------------------------- */
+			void _move_assign(vector & rhs, true_type) {
+				this->~vector();
+				this->_alloc = std::move(rhs._alloc);
+				_take_buffer(rhs);
+			}
+			void _move_assign(vector & rhs, false_type) {
+				if (this->_alloc == rhs._alloc) {
+					this->~vector();
+					_take_buffer(rhs);
+				} else
+					_assign_range(std::make_move_iterator(rhs._begin), std::make_move_iterator(rhs._begin + rhs._sz),
+						std::random_access_iterator_tag());
+			}
+			void _take_buffer(vector & x) {
+				this->_begin = x._begin;
+				this->_cap = x._cap;
+				this->_sz = x._sz;
+				x._begin = nullptr;
+				x._cap = 0;
+				x._sz = 0;
+			}
+			void _swap_alloc(vector & x, true_type) {ft::swap(this->_alloc, x._alloc);}
+			void _swap_alloc(vector &, false_type) {}
+			// Leaves n uninitialized slots at index before and returns a pointer to them.
+			// The tail is moved once as a single block, either inside the current buffer
+			// or straight into its final place in a new one. _sz is left untouched:
+			// the caller constructs into the gap and then accounts for it. If a copy
+			// throws while the tail shifts in place, the tail is lost and _sz drops to before.
+			pointer _open_gap(size_type before, size_type n) {
+				if (n > max_size() - this->_sz)
+					throw vector::LengthError();
+
+				if (this->_cap >= this->_sz + n) {
+					try {
+						ft::relocate_overlapping(this->_alloc, this->_begin + before,
+							this->_sz - before, this->_begin + before + n);
+					} catch (...) {
+						this->_sz = before;
+						throw;
+					}
+					return this->_begin + before;
+				}
+
+				size_type new_cap = GrowthPolicy::next(this->_cap, this->_sz + n, sizeof(value_type));
+				if (new_cap > max_size())
+					new_cap = max_size();
+
+				pointer new_begin = this->_alloc.allocate(new_cap);
+				if (this->_begin != nullptr) {
+					try {
+						ft::relocate_around(this->_alloc, this->_begin, this->_sz, new_begin, before, n);
+					} catch (...) {
+						this->_alloc.deallocate(new_begin, new_cap);
+						throw;
+					}
+					this->_alloc.deallocate(this->_begin, this->_cap);
+				}
+				this->_begin = new_begin;
+				this->_cap = new_cap;
+				return this->_begin + before;
+			}
+			// Undoes _open_gap after a constructor threw on the element number built.
+			void _close_gap(size_type before, size_type n, size_type built) {
+				for (size_type i = 0; i < built; i++)
+					this->_alloc.destroy(this->_begin + before + i);
+				try {
+					ft::relocate_overlapping(this->_alloc, this->_begin + before + n,
+						this->_sz - before, this->_begin + before);
+				} catch (...) {
+					this->_sz = before;
+					throw;
+				}
+			}
+			// Moves the elements to a buffer of exactly n; n must be at least size().
+			void _reallocate(size_type n) {
+				pointer new_begin = n ? this->_alloc.allocate(n) : nullptr;
+
+				if (this->_begin != nullptr) {
+					try {
+						ft::relocate(this->_alloc, this->_begin, this->_sz, new_begin);
+					} catch (...) {
+						if (new_begin != nullptr)
+							this->_alloc.deallocate(new_begin, n);
+						throw;
+					}
+					this->_alloc.deallocate(this->_begin, this->_cap);
+				}
+				this->_cap = n;
+				this->_begin = new_begin;
+			}
+			// Allocates exactly n and builds the elements on several threads.
+			template <class Build>
+			void _init_parallel(parallel_policy policy, size_type n, Build build) {
+				if (n > max_size())
+					throw vector::LengthError();
+				if (n == 0)
+					return;
+				try {
+					this->_begin = this->_alloc.allocate(n);
+				} catch(const std::exception& e) {
+					throw vector::LengthError();
+				}
+				this->_cap = n;
+				try {
+					ft::parallel_construct(policy, this->_alloc, this->_begin, n, build);
+				} catch (...) {
+					this->_alloc.deallocate(this->_begin, n);
+					this->_begin = nullptr;
+					this->_cap = 0;
+					throw;
+				}
+				this->_sz = n;
+			}
+			/* ------------------------------ Range helpers ----------------------------- */
+			// Sources that can be copied as one block of bytes.
+			template <class Iterator>
+			struct _is_memcpy_source : public integral_constant<bool,
+				ft::is_contiguous_iterator<Iterator>::value
+				&& std::is_same<typename ft::iterator_traits<Iterator>::value_type,
+					typename std::remove_cv<value_type>::type>::value
+				&& std::is_trivially_copyable<value_type>::value> {};
+
+			// Constructs n elements from first at dest; on throw destroys what it built.
+			template <class ForwardIterator>
+			void _construct_range(ForwardIterator first, size_type n, pointer dest) {
+				_construct_range(first, n, dest, integral_constant<bool, _is_memcpy_source<ForwardIterator>::value>());
+			}
+			template <class ForwardIterator>
+			void _construct_range(ForwardIterator first, size_type n, pointer dest, true_type) {
+				if (n != 0)
+					std::memcpy(const_cast<void *>(static_cast<const void *>(dest)), static_cast<const void *>(ft::to_address(first)),
+						n * sizeof(value_type));
+			}
+			template <class ForwardIterator>
+			void _construct_range(ForwardIterator first, size_type n, pointer dest, false_type) {
+				size_type built = 0;
+				try {
+					for (; built < n; ++first, ++built)
+						this->_alloc.construct(dest + built, *first);
+				} catch (...) {
+					while (built != 0)
+						this->_alloc.destroy(dest + --built);
+					throw;
+				}
+			}
+
+			// Input iterators: one pass, the buffer grows as elements arrive.
+			template <class InputIterator>
+			void _init_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
+				try {
+					for (; first != last; ++first)
+						emplace_back(*first);
+				} catch (...) {
+					this->~vector();
+					throw;
+				}
+			}
+			// Forward iterators: measure the range, then allocate once.
+			template <class ForwardIterator>
+			void _init_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				if (n > max_size())
+					throw vector::LengthError();
+				if (n == 0)
+					return;
+				try {
+					this->_begin = this->_alloc.allocate(n);
+				} catch(const std::exception& e) {
+					throw vector::LengthError();
+				}
+				this->_cap = n;
+				try {
+					_construct_range(first, n, this->_begin);
+				} catch (...) {
+					this->~vector();
+					throw;
+				}
+				this->_sz = n;
+			}
+
+			template <class InputIterator>
+			void _assign_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
+				size_type i = 0;
+				for (; i < this->_sz && first != last; ++i, ++first)
+					this->_begin[i] = *first;
+				if (first == last) {
+					erase(iterator(this->_begin + i), end());
+					return;
+				}
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+			template <class ForwardIterator>
+			void _assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				if (n > max_size())
+					throw vector::LengthError();
+				if (n > this->_cap) {
+					pointer fresh = this->_alloc.allocate(n);
+					try {
+						_construct_range(first, n, fresh);
+					} catch (...) {
+						this->_alloc.deallocate(fresh, n);
+						throw;
+					}
+					this->~vector();
+					this->_begin = fresh;
+					this->_cap = n;
+					this->_sz = n;
+					return;
+				}
+				// The source lives in our own buffer and could be overwritten before it is read
+				if (_aliases(first)) {
+					vector save(first, last, this->_alloc);
+					_assign_range(save.begin(), save.end(), std::forward_iterator_tag());
+					return;
+				}
+				_assign_over(first, n, integral_constant<bool, _is_memcpy_source<ForwardIterator>::value>());
+			}
+			// Reuses the buffer: assigns over the live elements, constructs or destroys the rest.
+			template <class ForwardIterator>
+			void _assign_over(ForwardIterator first, size_type n, true_type) {
+				if (n != 0)
+					std::memcpy(static_cast<void *>(this->_begin), static_cast<const void *>(ft::to_address(first)),
+						n * sizeof(value_type));
+				this->_sz = n;
+			}
+			template <class ForwardIterator>
+			void _assign_over(ForwardIterator first, size_type n, false_type) {
+				size_type i = 0;
+				for (; i < n && i < this->_sz; ++i, ++first)
+					this->_begin[i] = *first;
+				if (i < n)
+					_construct_range(first, n - i, this->_begin + i);
+				for (; i < this->_sz; ++i)
+					this->_alloc.destroy(this->_begin + i);
+				this->_sz = n;
+			}
+
+			// Input iterators: append at the end, then rotate the new elements into place.
+			template <class InputIterator>
+			void _insert_range(size_type before, InputIterator first, InputIterator last, std::input_iterator_tag) {
+				size_type old_size = this->_sz;
+				try {
+					for (; first != last; ++first)
+						emplace_back(*first);
+				} catch (...) {
+					erase(iterator(this->_begin + old_size), end());
+					throw;
+				}
+				std::rotate(this->_begin + before, this->_begin + old_size, this->_begin + this->_sz);
+			}
+			template <class ForwardIterator>
+			void _insert_range(size_type before, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				if (n == 0)
+					return;
+				// The source lives in our own buffer and would move with the tail
+				if (_aliases(first)) {
+					vector save(first, last, this->_alloc);
+					_insert_range(before, save.begin(), save.end(), std::forward_iterator_tag());
+					return;
+				}
+
+				pointer gap = _open_gap(before, n);
+				try {
+					_construct_range(first, n, gap);
+				} catch (...) {
+					_close_gap(before, n, 0);
+					throw;
+				}
+				this->_sz += n;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			bool _owns(const_pointer p) const {
+				return !std::less<const_pointer>()(p, this->_begin)
+					&& std::less<const_pointer>()(p, this->_begin + this->_sz);
+			}
+			template <class InputIterator>
+			bool _aliases(InputIterator) const {return false;}
+			template <class P>
+			bool _aliases(wrap_iter<P> it,
+				typename ft::enable_if<std::is_convertible<P, const_pointer>::value>::type* = 0) const {
+				return _owns(it.base());
+			}
+			template <class Iter>
+			bool _aliases(reverse_wrap_iter<Iter> it) const {return _aliases(it.base());}
+			bool _aliases(const_pointer p) const {return _owns(p);}
+			/* -------------------------------------------------------------------------- */
+
+		public:
 		class LengthError: public std::exception {
 			const char* what() const throw() {
 				return "vector";
@@ -349,29 +733,69 @@ namespace ft {
 		};
 	};
 
-	template <class T, class Alloc>
-	inline bool operator== (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs) {
+	// A vector only holds a pointer to its buffer, so it can be moved bitwise
+	// whenever its allocator can.
+	template <class T, class Alloc, class GrowthPolicy>
+	struct is_trivially_relocatable<ft::vector<T, Alloc, GrowthPolicy> > : public is_trivially_relocatable<Alloc> {};
+
+	// Erases every element satisfying pred in a single sweep: rejected elements
+	// are destroyed in place and the survivors are slid down over the holes.
+	// Returns the number of erased elements.
+	template <class T, class Alloc, class GrowthPolicy, class Predicate>
+	typename ft::vector<T,Alloc,GrowthPolicy>::size_type erase_if(ft::vector<T,Alloc,GrowthPolicy>& c, Predicate pred) {
+		typedef typename ft::vector<T,Alloc,GrowthPolicy>::size_type size_type;
+
+		size_type read = 0;
+		size_type write = 0;
+		try {
+			for (; read < c._sz; read++) {
+				if (pred(c._begin[read]))
+					c._alloc.destroy(c._begin + read);
+				else {
+					if (write != read)
+						ft::relocate(c._alloc, c._begin + read, 1, c._begin + write);
+					write++;
+				}
+			}
+		} catch (...) {
+			try {
+				ft::relocate_overlapping(c._alloc, c._begin + read, c._sz - read, c._begin + write);
+			} catch (...) {
+				c._sz = write;
+				throw;
+			}
+			c._sz -= read - write;
+			throw;
+		}
+		c._sz = write;
+		return read - write;
+	}
+
+	template <class T, class Alloc, class GrowthPolicy>
+	inline bool operator== (const ft::vector<T,Alloc,GrowthPolicy>& lhs, const ft::vector<T,Alloc,GrowthPolicy>& rhs) {
 		if (lhs.size() == rhs.size())
-			return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+			return ft::equal(lhs._begin, lhs._begin + lhs._sz, rhs._begin);
 		return false;
 	}
 
-	template <class T, class Alloc>
-	inline bool operator!=(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs) {return !(rhs == lhs);}
+	template <class T, class Alloc, class GrowthPolicy>
+	inline bool operator!=(const ft::vector<T,Alloc,GrowthPolicy>& lhs, const ft::vector<T,Alloc,GrowthPolicy>& rhs) {return !(rhs == lhs);}
 
-	template <class T, class Alloc>
-	inline bool operator<(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
-	{ return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());}
+	template <class T, class Alloc, class GrowthPolicy>
+	inline bool operator<(const ft::vector<T,Alloc,GrowthPolicy>& lhs, const ft::vector<T,Alloc,GrowthPolicy>& rhs)
+	{ return ft::lexicographical_compare(lhs._begin, lhs._begin + lhs._sz, rhs._begin, rhs._begin + rhs._sz);}
 
-	template <class T, class Alloc>
-	inline bool operator>  (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs) {return rhs < lhs;}
+	template <class T, class Alloc, class GrowthPolicy>
+	inline bool operator>  (const ft::vector<T,Alloc,GrowthPolicy>& lhs, const ft::vector<T,Alloc,GrowthPolicy>& rhs) {return rhs < lhs;}
 
-	template <class T, class Alloc>
-	inline bool operator<= (const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs) {return !(rhs < lhs);}
+	template <class T, class Alloc, class GrowthPolicy>
+	inline bool operator<= (const ft::vector<T,Alloc,GrowthPolicy>& lhs, const ft::vector<T,Alloc,GrowthPolicy>& rhs) {return !(rhs < lhs);}
 
-	template <class T, class Alloc>
-	inline bool operator>= (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {return !(lhs < rhs);}
+	template <class T, class Alloc, class GrowthPolicy>
+	inline bool operator>= (const vector<T,Alloc,GrowthPolicy>& lhs, const vector<T,Alloc,GrowthPolicy>& rhs) {return !(lhs < rhs);}
 }
 /* -------------------------------------------------------------------------- */
 
+# include "ft_vector_bool.hpp"
+
 #endif
@@ -0,0 +1,626 @@
+#ifndef FT_VECTOR_BOOL_HPP
+# define FT_VECTOR_BOOL_HPP
+
+/* ------------------------------- Explanation ------------------------------ */
+// Packed specialization of ft::vector for bool: one bit per flag, stored in
+// 64-bit words, so a bitmap takes 8 times less memory than one byte per flag.
+// Elements are not addressable, so operator[] and the iterators hand out a
+// proxy (vector<bool>::reference) that reads and writes a single bit.
+//
+// Bits past size() are always zero. The word kernels rely on it:
+//	• count()                   - popcount over whole words;
+//	• find_first() / find_next() - skip zero words, then count trailing zeros;
+//	• flip()                    - negate whole words, then clear the tail;
+//	• &=, |=, ^=                - combine two bitmaps word by word;
+//	• ==, <                     - compare whole words.
+// The word loops are plain enough for the compiler to vectorize.
+//
+// Included by ft_vector.hpp, do not include it directly.
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Headers --------------------------------- */
+# include <stdint.h>
+# include <cstring>
+# include <iterator>
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+
+	/* ------------------------------ Bit iterator ------------------------------ */
+	template <class Word, bool IsConst>
+	class bit_iterator;
+
+	// Proxy standing for one bit of a packed vector<bool>.
+	template <class Word>
+	class bit_reference {
+		public:
+			bit_reference(Word *word, Word mask) : _word(word), _mask(mask) {}
+
+			operator bool(void) const {return (*this->_word & this->_mask) != 0;}
+			bool operator~(void) const {return !static_cast<bool>(*this);}
+			bit_reference & operator=(bool x) {
+				if (x)
+					*this->_word |= this->_mask;
+				else
+					*this->_word &= ~this->_mask;
+				return *this;
+			}
+			bit_reference & operator=(bit_reference const & x) {return *this = static_cast<bool>(x);}
+			void flip(void) {*this->_word ^= this->_mask;}
+
+		private:
+			Word *_word;
+			Word _mask;
+	};
+
+	template <class Word, bool IsConst>
+	class bit_iterator {
+		public:
+			typedef std::random_access_iterator_tag				iterator_category;
+			typedef bool										value_type;
+			typedef std::ptrdiff_t								difference_type;
+			typedef typename std::conditional<IsConst, const Word, Word>::type	word_type;
+			typedef typename std::conditional<IsConst, bool, bit_reference<Word> >::type	reference;
+			typedef void										pointer;
+			typedef bit_iterator<Word, IsConst>					this_type;
+
+			static const unsigned bits = sizeof(Word) * CHAR_SIZE;
+
+			bit_iterator(void) : _word(nullptr), _bit(0) {}
+			bit_iterator(word_type *word, unsigned bit) : _word(word), _bit(bit) {}
+			// iterator -> const_iterator
+			template <bool C>
+			bit_iterator(bit_iterator<Word, C> const & x,
+				typename ft::enable_if<IsConst && !C>::type* = 0) : _word(x.word()), _bit(x.bit()) {}
+
+			reference operator*(void) const {return _deref(integral_constant<bool, IsConst>());}
+			reference operator[](difference_type n) const {return *(*this + n);}
+			this_type & operator++(void) {
+				if (++this->_bit == bits) {
+					this->_bit = 0;
+					++this->_word;
+				}
+				return *this;
+			}
+			this_type operator++(int) {this_type tmp(*this); ++(*this); return tmp;}
+			this_type & operator--(void) {
+				if (this->_bit-- == 0) {
+					this->_bit = bits - 1;
+					--this->_word;
+				}
+				return *this;
+			}
+			this_type operator--(int) {this_type tmp(*this); --(*this); return tmp;}
+			this_type & operator+=(difference_type n) {
+				difference_type pos = static_cast<difference_type>(this->_bit) + n;
+				difference_type words = pos / static_cast<difference_type>(bits);
+				pos %= static_cast<difference_type>(bits);
+				if (pos < 0) {
+					pos += bits;
+					--words;
+				}
+				this->_word += words;
+				this->_bit = static_cast<unsigned>(pos);
+				return *this;
+			}
+			this_type & operator-=(difference_type n) {return *this += -n;}
+			this_type operator+(difference_type n) const {this_type tmp(*this); tmp += n; return tmp;}
+			this_type operator-(difference_type n) const {this_type tmp(*this); tmp -= n; return tmp;}
+
+			word_type *word(void) const {return this->_word;}
+			unsigned bit(void) const {return this->_bit;}
+
+		private:
+			bool _deref(true_type) const {return (*this->_word >> this->_bit) & 1;}
+			bit_reference<Word> _deref(false_type) const {return bit_reference<Word>(this->_word, Word(1) << this->_bit);}
+
+			word_type *_word;
+			unsigned _bit;
+	};
+
+	# define BIT_TEMPLATE template<class Word, bool C1, bool C2>
+	# define BIT_LHS bit_iterator<Word, C1>
+	# define BIT_RHS bit_iterator<Word, C2>
+
+	BIT_TEMPLATE
+	inline typename BIT_LHS::difference_type operator-(BIT_LHS const & lhs, BIT_RHS const & rhs) {
+		return (lhs.word() - rhs.word()) * static_cast<std::ptrdiff_t>(BIT_LHS::bits)
+			+ static_cast<std::ptrdiff_t>(lhs.bit()) - static_cast<std::ptrdiff_t>(rhs.bit());
+	}
+	BIT_TEMPLATE
+	inline bool operator==(BIT_LHS const & lhs, BIT_RHS const & rhs) {
+		return lhs.word() == rhs.word() && lhs.bit() == rhs.bit();
+	}
+	BIT_TEMPLATE
+	inline bool operator!=(BIT_LHS const & lhs, BIT_RHS const & rhs) {return !(lhs == rhs);}
+	BIT_TEMPLATE
+	inline bool operator<(BIT_LHS const & lhs, BIT_RHS const & rhs) {return (lhs - rhs) < 0;}
+	BIT_TEMPLATE
+	inline bool operator>(BIT_LHS const & lhs, BIT_RHS const & rhs) {return (lhs - rhs) > 0;}
+	BIT_TEMPLATE
+	inline bool operator<=(BIT_LHS const & lhs, BIT_RHS const & rhs) {return (lhs - rhs) <= 0;}
+	BIT_TEMPLATE
+	inline bool operator>=(BIT_LHS const & lhs, BIT_RHS const & rhs) {return (lhs - rhs) >= 0;}
+
+	template <class Word, bool C>
+	inline bit_iterator<Word, C> operator+(std::ptrdiff_t n, bit_iterator<Word, C> const & it) {return it + n;}
+	/* -------------------------------------------------------------------------- */
+
+	template <typename Alloc, typename GrowthPolicy>
+	class vector<bool, Alloc, GrowthPolicy> {
+		public:
+			typedef uint64_t								word_type;
+		private:
+			typedef typename Alloc::template rebind<word_type>::other	word_allocator;
+			typedef std::allocator_traits<word_allocator>				_alloc_traits;
+		public:
+			typedef Alloc									allocator_type;
+			typedef bool									value_type;
+			typedef bit_reference<word_type>				reference;
+			typedef bool									const_reference;
+			typedef bit_iterator<word_type, false>			iterator;
+			typedef bit_iterator<word_type, true>			const_iterator;
+			typedef reverse_wrap_iter<iterator>				reverse_iterator;
+			typedef reverse_wrap_iter<const_iterator>		const_reverse_iterator;
+
+			typedef std::size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+
+			static const size_type bits_per_word = sizeof(word_type) * CHAR_SIZE;
+
+			word_type *_begin;
+			word_allocator _alloc;
+			size_type _cap;		// in words
+			size_type _sz;		// in bits
+
+			/* ------------------------------ Constructors ------------------------------ */
+			explicit vector (const allocator_type & alloc = allocator_type())
+				: _begin(nullptr), _alloc(alloc), _cap(EMPTY), _sz(EMPTY)
+			{}
+			explicit vector (size_type n, const value_type& val = value_type(),
+				const allocator_type& alloc = allocator_type())
+				: _begin(nullptr), _alloc(alloc), _cap(EMPTY), _sz(EMPTY) {
+				_reallocate(_words(n));
+				_fill(0, n, val);
+				this->_sz = n;
+			}
+			template <class InputIterator>
+			vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(),
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0)
+				: _begin(nullptr), _alloc(alloc), _cap(EMPTY), _sz(EMPTY) {
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			vector (const vector& x)
+				: _begin(nullptr), _alloc(x._alloc), _cap(EMPTY), _sz(EMPTY) {
+				_reallocate(_words(x._sz));
+				_copy_words(x._begin, _words(x._sz));
+				this->_sz = x._sz;
+			}
+			vector (vector&& x) noexcept
+				: _begin(x._begin), _alloc(std::move(x._alloc)), _cap(x._cap), _sz(x._sz) {
+				x._begin = nullptr;
+				x._cap = 0;
+				x._sz = 0;
+			}
+			~vector(void) {
+				if (this->_begin != nullptr)
+					this->_alloc.deallocate(this->_begin, this->_cap);
+			}
+			vector & operator=(vector const & rhs) {
+				if (this == &rhs)
+					return *this;
+				if (this->_cap < _words(rhs._sz))
+					_reallocate(_words(rhs._sz));
+				_copy_words(rhs._begin, _words(rhs._sz));
+				this->_sz = rhs._sz;
+				return *this;
+			}
+			// Same allocator rules as the generic vector: unequal allocators that do not
+			// propagate get the words copied instead of the buffer.
+			vector & operator=(vector&& rhs) noexcept(_alloc_traits::propagate_on_container_move_assignment::value) {
+				if (this == &rhs)
+					return *this;
+				_move_assign(rhs, integral_constant<bool, _alloc_traits::propagate_on_container_move_assignment::value>());
+				return *this;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Iterators ------------------------------- */
+			iterator	begin(void) {return iterator(this->_begin, 0);}
+			iterator	end(void) {return begin() + this->_sz;}
+			const_iterator begin(void) const {return const_iterator(this->_begin, 0);}
+			const_iterator end(void) const {return begin() + this->_sz;}
+			reverse_iterator	rbegin(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(begin());
+				return reverse_iterator(end() - 1);
+			}
+			reverse_iterator	rend(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(begin());
+				return reverse_iterator(begin() - 1);
+			}
+			const_reverse_iterator	rbegin(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(begin());
+				return const_reverse_iterator(end() - 1);
+			}
+			const_reverse_iterator	rend(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(begin());
+				return const_reverse_iterator(begin() - 1);
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Capacity -------------------------------- */
+			size_type size(void) const {return this->_sz;}
+			size_type max_size(void) const {
+				size_type words = this->_alloc.max_size();
+				if (words > std::numeric_limits<size_type>::max() / bits_per_word)
+					return std::numeric_limits<size_type>::max();
+				return words * bits_per_word;
+			}
+			size_type capacity(void) const {return this->_cap * bits_per_word;}
+			bool empty(void) const {return this->_sz == 0;}
+			void resize(size_type n, value_type val = value_type()) {
+				if (n <= this->_sz) {
+					this->_sz = n;
+					_clear_tail();
+					return;
+				}
+				_ensure(n);
+				_fill(this->_sz, n, val);
+				this->_sz = n;
+			}
+			void reserve(size_type n) {
+				if (n > max_size())
+					throw vector::LengthError();
+				if (_words(n) > this->_cap)
+					_reallocate(_words(n));
+			}
+			void shrink_to_fit(void) {
+				if (this->_cap > _words(this->_sz))
+					_reallocate(_words(this->_sz));
+			}
+			memory_usage_info memory_usage(void) const {
+				return memory_usage_info(_words(this->_sz) * sizeof(word_type),
+					(this->_cap - _words(this->_sz)) * sizeof(word_type), 0);
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* ----------------------------- Element access ----------------------------- */
+			reference operator[](size_type n) {return reference(this->_begin + n / bits_per_word, _mask(n));}
+			const_reference operator[](size_type n) const {return _get(n);}
+			reference at(size_type n) {
+				if (n >= this->_sz)
+					throw vector::Out_of_range();
+				return (*this)[n];
+			}
+			const_reference at(size_type n) const {
+				if (n >= this->_sz)
+					throw vector::Out_of_range();
+				return (*this)[n];
+			}
+			reference front(void) {return (*this)[0];}
+			const_reference front(void) const {return (*this)[0];}
+			reference back(void) {return (*this)[this->_sz - 1];}
+			const_reference back(void) const {return (*this)[this->_sz - 1];}
+			// The packed words; bits past size() are zero.
+			word_type *data(void) {return this->_begin;}
+			const word_type *data(void) const {return this->_begin;}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Modifiers ------------------------------- */
+			template <class InputIterator>
+			void assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				vector save(first, last, get_allocator());
+				swap(save);
+			}
+			void assign(size_type n, const value_type& val) {
+				clear();
+				resize(n, val);
+			}
+			void push_back(const value_type & val) {
+				_ensure(this->_sz + 1);
+				_set(this->_sz++, val);
+			}
+			void pop_back(void) {
+				_set(--this->_sz, false);
+			}
+			iterator insert (iterator position, const value_type& val) {
+				return insert(position, 1, val);
+			}
+			iterator insert (iterator position, size_type n, const value_type& val) {
+				size_type before = position - begin();
+
+				_open_gap(before, n);
+				_fill(before, before + n, val);
+				return begin() + before;
+			}
+			template <class InputIterator>
+			void insert (iterator position, InputIterator first, InputIterator last,
+				typename ft::enable_if<!std::numeric_limits<InputIterator>::is_specialized>::type* = 0) {
+				vector save(first, last, get_allocator());
+				size_type before = position - begin();
+
+				_open_gap(before, save._sz);
+				for (size_type i = 0; i < save._sz; i++)
+					_set(before + i, save._get(i));
+			}
+			iterator erase(iterator position) {return erase(position, position + 1);}
+			iterator erase(iterator first, iterator last) {
+				size_type start = first - begin();
+				size_type count = last - first;
+				size_type used = _words(this->_sz);
+
+				if (count == 0)
+					return begin() + start;
+				_shift_down(start, count);
+				this->_sz -= count;
+				// The shift pulled in the zero bits past the old size; only the
+				// words the vector no longer uses still hold bits.
+				if (_words(this->_sz) < used)
+					std::memset(this->_begin + _words(this->_sz), 0, (used - _words(this->_sz)) * sizeof(word_type));
+				return begin() + start;
+			}
+			void swap(vector& x) {
+				_swap_words(x);
+				_swap_alloc(x, integral_constant<bool, _alloc_traits::propagate_on_container_swap::value>());
+			}
+			static void swap(reference x, reference y) {
+				bool tmp = x;
+				x = y;
+				y = tmp;
+			}
+			void clear(void) {
+				if (this->_sz != 0)
+					std::memset(this->_begin, 0, _words(this->_sz) * sizeof(word_type));
+				this->_sz = 0;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* ------------------------------ Word kernels ------------------------------ */
+			// Number of set bits.
+			size_type count(void) const {
+				size_type total = 0;
+				for (size_type w = 0; w < _words(this->_sz); w++)
+					total += __builtin_popcountll(this->_begin[w]);
+				return total;
+			}
+			// Index of the first set bit, or size() when there is none.
+			size_type find_first(void) const {return this->_sz == 0 ? 0 : _scan(0);}
+			// Index of the first set bit after pos, or size() when there is none.
+			size_type find_next(size_type pos) const {return pos + 1 >= this->_sz ? this->_sz : _scan(pos + 1);}
+			void flip(void) {
+				for (size_type w = 0; w < _words(this->_sz); w++)
+					this->_begin[w] = ~this->_begin[w];
+				_clear_tail();
+			}
+			// Bits past x.size() are treated as zero.
+			vector & operator&=(vector const & x) {
+				size_type common = _common_words(x);
+				for (size_type w = 0; w < common; w++)
+					this->_begin[w] &= x._begin[w];
+				if (_words(this->_sz) > common)
+					std::memset(this->_begin + common, 0, (_words(this->_sz) - common) * sizeof(word_type));
+				return *this;
+			}
+			vector & operator|=(vector const & x) {
+				size_type common = _common_words(x);
+				for (size_type w = 0; w < common; w++)
+					this->_begin[w] |= x._begin[w];
+				_clear_tail();
+				return *this;
+			}
+			vector & operator^=(vector const & x) {
+				size_type common = _common_words(x);
+				for (size_type w = 0; w < common; w++)
+					this->_begin[w] ^= x._begin[w];
+				_clear_tail();
+				return *this;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Allocator ------------------------------- */
+			allocator_type get_allocator(void) const {return allocator_type(this->_alloc);}
+			/* -------------------------------------------------------------------------- */
+
+		private:
+			/* ----------------------------- Internal helpers ---------------------------- */
+			void _move_assign(vector & rhs, true_type) {
+				_swap_words(rhs);
+				ft::swap(this->_alloc, rhs._alloc);
+			}
+			void _move_assign(vector & rhs, false_type) {
+				if (this->_alloc == rhs._alloc)
+					_swap_words(rhs);
+				else
+					*this = rhs;
+			}
+			void _swap_words(vector & x) {
+				ft::swap(this->_begin, x._begin);
+				ft::swap(this->_sz, x._sz);
+				ft::swap(this->_cap, x._cap);
+			}
+			void _swap_alloc(vector & x, true_type) {ft::swap(this->_alloc, x._alloc);}
+			void _swap_alloc(vector &, false_type) {}
+			static size_type _words(size_type bits) {return (bits + bits_per_word - 1) / bits_per_word;}
+			static word_type _mask(size_type n) {return word_type(1) << (n % bits_per_word);}
+			bool _get(size_type n) const {return (this->_begin[n / bits_per_word] & _mask(n)) != 0;}
+			void _set(size_type n, bool val) {
+				if (val)
+					this->_begin[n / bits_per_word] |= _mask(n);
+				else
+					this->_begin[n / bits_per_word] &= ~_mask(n);
+			}
+			// Sets bits [from, to) to val, whole words at a time in the middle.
+			void _fill(size_type from, size_type to, bool val) {
+				while (from < to && from % bits_per_word != 0)
+					_set(from++, val);
+				word_type word = val ? ~word_type(0) : word_type(0);
+				for (; from + bits_per_word <= to; from += bits_per_word)
+					this->_begin[from / bits_per_word] = word;
+				while (from < to)
+					_set(from++, val);
+			}
+			void _clear_tail(void) {
+				if (this->_sz % bits_per_word != 0)
+					this->_begin[this->_sz / bits_per_word] &= _mask(this->_sz) - 1;
+				size_type used = _words(this->_sz);
+				if (this->_begin != nullptr && used < this->_cap)
+					std::memset(this->_begin + used, 0, (this->_cap - used) * sizeof(word_type));
+			}
+			size_type _common_words(vector const & x) const {
+				size_type mine = _words(this->_sz);
+				size_type theirs = _words(x._sz);
+				return mine < theirs ? mine : theirs;
+			}
+			size_type _scan(size_type from) const {
+				size_type w = from / bits_per_word;
+				word_type word = this->_begin[w] & ~(_mask(from) - 1);
+
+				while (true) {
+					if (word != 0)
+						return w * bits_per_word + __builtin_ctzll(word);
+					if (++w >= _words(this->_sz))
+						return this->_sz;
+					word = this->_begin[w];
+				}
+			}
+			void _copy_words(const word_type *src, size_type words) {
+				if (words != 0)
+					std::memcpy(this->_begin, src, words * sizeof(word_type));
+				if (words < this->_cap)
+					std::memset(this->_begin + words, 0, (this->_cap - words) * sizeof(word_type));
+			}
+			// Replaces the buffer with one of words words, keeping the bits; new words are zero.
+			void _reallocate(size_type words) {
+				word_type *fresh = words ? this->_alloc.allocate(words) : nullptr;
+				size_type keep = _words(this->_sz);
+
+				if (keep != 0)
+					std::memcpy(fresh, this->_begin, keep * sizeof(word_type));
+				if (words > keep)
+					std::memset(fresh + keep, 0, (words - keep) * sizeof(word_type));
+				if (this->_begin != nullptr)
+					this->_alloc.deallocate(this->_begin, this->_cap);
+				this->_begin = fresh;
+				this->_cap = words;
+			}
+			void _ensure(size_type bits) {
+				if (bits > max_size())
+					throw vector::LengthError();
+				if (_words(bits) > this->_cap)
+					_reallocate(GrowthPolicy::next(this->_cap, _words(bits), sizeof(word_type)));
+			}
+			// Makes room for n bits at index before by moving the tail up.
+			void _open_gap(size_type before, size_type n) {
+				if (n == 0)
+					return;
+				_ensure(this->_sz + n);
+				_shift_up(before, n);
+				this->_sz += n;
+			}
+			// The tail moves a word at a time: each destination word is a funnel shift
+			// of the two source words it straddles. Only the first word is masked, to
+			// keep the bits below the shifted range. Bits past size() are zero, so the
+			// tail of the last word comes out zero too.
+			void _shift_up(size_type before, size_type n) {
+				size_type words = n / bits_per_word;
+				unsigned s = n % bits_per_word;
+				size_type first = (before + n) / bits_per_word;
+				word_type keep = _mask(before + n) - 1;
+
+				for (size_type i = _words(this->_sz + n); i-- > first; ) {
+					word_type hi = i >= words ? this->_begin[i - words] : 0;
+					word_type lo = i >= words + 1 ? this->_begin[i - words - 1] : 0;
+					word_type w = s ? (hi << s) | (lo >> (bits_per_word - s)) : hi;
+					if (i == first)
+						w = (this->_begin[i] & keep) | (w & ~keep);
+					this->_begin[i] = w;
+				}
+			}
+			// Moves the bits from start + n to the end down to start.
+			void _shift_down(size_type start, size_type n) {
+				size_type words = n / bits_per_word;
+				unsigned s = n % bits_per_word;
+				size_type first = start / bits_per_word;
+				size_type last = _words(this->_sz - n);
+				size_type used = _words(this->_sz);
+				word_type keep = _mask(start) - 1;
+
+				for (size_type i = first; i < last; i++) {
+					word_type lo = i + words < used ? this->_begin[i + words] : 0;
+					word_type hi = i + words + 1 < used ? this->_begin[i + words + 1] : 0;
+					word_type w = s ? (lo >> s) | (hi << (bits_per_word - s)) : lo;
+					if (i == first)
+						w = (this->_begin[i] & keep) | (w & ~keep);
+					this->_begin[i] = w;
+				}
+			}
+			/* -------------------------------------------------------------------------- */
+
+		public:
+		class LengthError: public std::exception {
+			const char* what() const throw() {
+				return "vector";
+			}
+		};
+
+		class Out_of_range : public std::exception {
+			const char*  what() const throw() {
+				return "vector";
+			}
+		};
+	};
+
+	template <class Alloc, class GrowthPolicy, class Predicate>
+	typename ft::vector<bool,Alloc,GrowthPolicy>::size_type erase_if(ft::vector<bool,Alloc,GrowthPolicy>& c, Predicate pred) {
+		typedef typename ft::vector<bool,Alloc,GrowthPolicy>::size_type size_type;
+		size_type write = 0;
+		size_type size = c.size();
+
+		for (size_type read = 0; read < size; read++) {
+			bool bit = c[read];
+			if (!pred(bit))
+				c[write++] = bit;
+		}
+		c.resize(write);
+		return size - write;
+	}
+
+	template <class Alloc, class GrowthPolicy>
+	inline bool operator== (const ft::vector<bool,Alloc,GrowthPolicy>& lhs, const ft::vector<bool,Alloc,GrowthPolicy>& rhs) {
+		typedef typename ft::vector<bool,Alloc,GrowthPolicy>::word_type word_type;
+		typedef typename ft::vector<bool,Alloc,GrowthPolicy>::size_type size_type;
+
+		if (lhs.size() != rhs.size())
+			return false;
+		size_type words = (lhs.size() + lhs.bits_per_word - 1) / lhs.bits_per_word;
+		return words == 0 || std::memcmp(lhs.data(), rhs.data(), words * sizeof(word_type)) == 0;
+	}
+
+	// Lexicographic in index order: the first differing bit is the lowest set bit of the xor.
+	template <class Alloc, class GrowthPolicy>
+	inline bool operator<(const ft::vector<bool,Alloc,GrowthPolicy>& lhs, const ft::vector<bool,Alloc,GrowthPolicy>& rhs) {
+		typedef typename ft::vector<bool,Alloc,GrowthPolicy>::word_type word_type;
+		typedef typename ft::vector<bool,Alloc,GrowthPolicy>::size_type size_type;
+
+		size_type common = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+		size_type full = common / lhs.bits_per_word;
+		for (size_type w = 0; w <= full; w++) {
+			word_type diff = 0;
+			if (w < full)
+				diff = lhs.data()[w] ^ rhs.data()[w];
+			else if (common % lhs.bits_per_word != 0)
+				diff = (lhs.data()[w] ^ rhs.data()[w]) & ((word_type(1) << (common % lhs.bits_per_word)) - 1);
+			if (diff != 0)
+				return (rhs.data()[w] >> __builtin_ctzll(diff)) & 1;
+		}
+		return lhs.size() < rhs.size();
+	}
+}
+
+#endif
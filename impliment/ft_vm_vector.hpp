@@ -0,0 +1,342 @@
+#ifndef FT_VM_VECTOR_HPP
+# define FT_VM_VECTOR_HPP
+
+/* ------------------------------- Explanation ------------------------------ */
+// vm_vector reserves one large range of address space up front with
+// mmap(PROT_NONE) and commits pages (mprotect to read/write) as it grows.
+// The buffer therefore never moves:
+//	• push_back never copies or relocates the elements already stored;
+//	• pointers, references and iterators stay valid while the vector grows;
+//	• peak memory is the payload, not payload + old buffer during a copy.
+// Untouched committed pages cost nothing until they are written to, and the
+// reservation itself only costs address space.
+// The price is a fixed maximum size, chosen at construction (max_size()).
+// Growing past it throws vm_vector::LengthError.
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Headers --------------------------------- */
+# include <memory>
+# include <new>
+# include <limits>
+# include <utility>
+# include <functional>
+# include <sys/mman.h>
+# include <unistd.h>
+# include "utility.hpp"
+# include "iterator.hpp"
+# include "reverse_iterator.hpp"
+# include "relocate.hpp"
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------- Macroses -------------------------------- */
+// Address space reserved by a default constructed vm_vector.
+# define VM_VECTOR_DEFAULT_RESERVE (std::size_t(1) << 36)
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+
+	template <typename T>
+	class vm_vector {
+		public:
+			typedef T										value_type;
+			typedef T&										reference;
+			typedef const T&								const_reference;
+			typedef T*										pointer;
+			typedef const T*								const_pointer;
+			typedef wrap_iter<pointer>						iterator;
+			typedef wrap_iter<const_pointer>				const_iterator;
+			typedef reverse_wrap_iter<iterator>				reverse_iterator;
+			typedef reverse_wrap_iter<const_iterator>		const_reverse_iterator;
+
+			typedef std::size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+
+		private:
+			// Elements are built in place, std::allocator<T> only supplies construct/destroy.
+			typedef std::allocator<T>						construct_type;
+
+			pointer _begin;
+			size_type _sz;
+			size_type _committed;	// bytes with read/write access
+			size_type _reserved;	// bytes of address space
+			construct_type _alloc;
+
+		public:
+			/* ------------------------------ Constructors ------------------------------ */
+			// Reserves room for max_elements; nothing is committed yet.
+			explicit vm_vector (size_type max_elements = VM_VECTOR_DEFAULT_RESERVE / sizeof(T))
+				: _begin(nullptr), _sz(0), _committed(0), _reserved(0) {
+				_reserve_address_space(max_elements);
+			}
+			vm_vector (const vm_vector& x)
+				: _begin(nullptr), _sz(0), _committed(0), _reserved(0) {
+				_reserve_address_space(x.max_size());
+				try {
+					reserve(x._sz);
+					for (; this->_sz < x._sz; this->_sz++)
+						this->_alloc.construct(this->_begin + this->_sz, x._begin[this->_sz]);
+				} catch (...) {
+					clear();
+					::munmap(this->_begin, this->_reserved);
+					throw;
+				}
+			}
+			vm_vector (vm_vector&& x) noexcept
+				: _begin(x._begin), _sz(x._sz), _committed(x._committed), _reserved(x._reserved) {
+				x._begin = nullptr;
+				x._sz = 0;
+				x._committed = 0;
+				x._reserved = 0;
+			}
+			~vm_vector(void) {
+				if (this->_begin == nullptr)
+					return;
+				clear();
+				::munmap(this->_begin, this->_reserved);
+			}
+			vm_vector & operator=(vm_vector const & rhs) {
+				if (this == &rhs)
+					return *this;
+				// Only rhs's elements have to fit, not its whole reservation.
+				if (this->_begin != nullptr && rhs._sz > max_size())
+					throw vm_vector::LengthError();
+				clear();
+				if (this->_begin == nullptr)
+					_reserve_address_space(rhs.max_size());
+				reserve(rhs._sz);
+				for (; this->_sz < rhs._sz; this->_sz++)
+					this->_alloc.construct(this->_begin + this->_sz, rhs._begin[this->_sz]);
+				return *this;
+			}
+			vm_vector & operator=(vm_vector&& rhs) noexcept {
+				swap(rhs);
+				return *this;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Iterators ------------------------------- */
+			iterator	begin(void) {return iterator(this->_begin);}
+			iterator	end(void) {return iterator(this->_begin + this->_sz);}
+			const_iterator begin(void) const {return const_iterator(this->_begin);}
+			const_iterator end(void) const {return const_iterator(this->_begin + this->_sz);}
+			reverse_iterator	rbegin(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(iterator(this->_begin));
+				return reverse_iterator(iterator(this->_begin + this->_sz - 1));
+			}
+			reverse_iterator	rend(void) {
+				if (this->_sz == 0)
+					return reverse_iterator(iterator(this->_begin));
+				return reverse_iterator(iterator(this->_begin - 1));
+			}
+			const_reverse_iterator	rbegin(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(const_iterator(this->_begin));
+				return const_reverse_iterator(const_iterator(this->_begin + this->_sz - 1));
+			}
+			const_reverse_iterator	rend(void) const {
+				if (this->_sz == 0)
+					return const_reverse_iterator(const_iterator(this->_begin));
+				return const_reverse_iterator(const_iterator(this->_begin - 1));
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Capacity -------------------------------- */
+			size_type size(void) const {return this->_sz;}
+			// The reservation: the vector can never hold more than this.
+			size_type max_size(void) const {return this->_reserved / sizeof(value_type);}
+			size_type capacity(void) const {return this->_committed / sizeof(value_type);}
+			bool empty(void) const {return this->_sz == 0;}
+			void resize(size_type n, value_type val = value_type()) {
+				if (n <= this->_sz) {
+					erase(iterator(this->_begin + n), end());
+					return;
+				}
+				reserve(n);
+				for (; this->_sz < n; this->_sz++)
+					this->_alloc.construct(this->_begin + this->_sz, val);
+			}
+			// Commits pages up to n elements. Never moves anything.
+			void reserve(size_type n) {
+				if (this->_begin == nullptr)	// moved from
+					_reserve_address_space(VM_VECTOR_DEFAULT_RESERVE / sizeof(value_type));
+				if (n > max_size())
+					throw vm_vector::LengthError();
+				if (n > capacity())
+					_commit(n * sizeof(value_type));
+			}
+			// Gives the pages past size() back to the system, keeping the reservation.
+			void shrink_to_fit(void) {
+				size_type keep = _round_to_page(this->_sz * sizeof(value_type));
+
+				if (keep >= this->_committed)
+					return;
+				::madvise(reinterpret_cast<char *>(this->_begin) + keep, this->_committed - keep, MADV_DONTNEED);
+				::mprotect(reinterpret_cast<char *>(this->_begin) + keep, this->_committed - keep, PROT_NONE);
+				this->_committed = keep;
+			}
+			/* -------------------------------------------------------------------------- */
+
+			/* ----------------------------- Element access ----------------------------- */
+			reference operator[](size_type n) {return this->_begin[n];}
+			const_reference operator[](size_type n) const {return this->_begin[n];}
+			reference at(size_type n) {
+				if (n >= this->_sz)
+					throw vm_vector::Out_of_range();
+				return this->_begin[n];
+			}
+			const_reference at(size_type n) const {
+				if (n >= this->_sz)
+					throw vm_vector::Out_of_range();
+				return this->_begin[n];
+			}
+			reference front(void) {return *this->_begin;}
+			const_reference front(void) const {return *this->_begin;}
+			reference back(void) {return this->_begin[this->_sz - 1];}
+			const_reference back(void) const {return this->_begin[this->_sz - 1];}
+			pointer data(void) {return this->_begin;}
+			const_pointer data(void) const {return this->_begin;}
+			/* -------------------------------------------------------------------------- */
+
+			/* -------------------------------- Modifiers ------------------------------- */
+			template <class... Args>
+			void emplace_back(Args&&... args) {
+				if (this->_sz == capacity())
+					reserve(this->_sz + 1);
+				this->_alloc.construct(this->_begin + this->_sz, std::forward<Args>(args)...);
+				this->_sz++;
+			}
+			void push_back(const value_type & val) {emplace_back(val);}
+			void push_back(value_type&& val) {emplace_back(std::move(val));}
+			void pop_back(void) {
+				this->_alloc.destroy(this->_begin + this->_sz - 1);
+				this->_sz--;
+			}
+			// Inserting in the middle shifts the tail in place; the buffer still stays put.
+			iterator insert(iterator position, const value_type& val) {
+				size_type before = position - begin();
+				value_type save(val);
+
+				if (this->_sz == capacity())
+					reserve(this->_sz + 1);
+				try {
+					ft::relocate_overlapping(this->_alloc, this->_begin + before,
+						this->_sz - before, this->_begin + before + 1);
+				} catch (...) {
+					this->_sz = before;
+					throw;
+				}
+				try {
+					this->_alloc.construct(this->_begin + before, std::move(save));
+				} catch (...) {
+					try {
+						ft::relocate_overlapping(this->_alloc, this->_begin + before + 1,
+							this->_sz - before, this->_begin + before);
+					} catch (...) {
+						this->_sz = before;
+						throw;
+					}
+					throw;
+				}
+				this->_sz++;
+				return iterator(this->_begin + before);
+			}
+			iterator erase(iterator position) {return erase(position, position + 1);}
+			iterator erase(iterator first, iterator last) {
+				size_type start = first - begin();
+				size_type count = last - first;
+
+				for (size_type i = start; i < start + count; i++)
+					this->_alloc.destroy(this->_begin + i);
+				try {
+					ft::relocate_overlapping(this->_alloc, this->_begin + start + count,
+						this->_sz - start - count, this->_begin + start);
+				} catch (...) {
+					this->_sz = start;
+					throw;
+				}
+				this->_sz -= count;
+				return iterator(this->_begin + start);
+			}
+			void clear(void) {
+				for (size_type i = 0; i < this->_sz; i++)
+					this->_alloc.destroy(this->_begin + i);
+				this->_sz = 0;
+			}
+			void swap(vm_vector& x) {
+				ft::swap(this->_begin, x._begin);
+				ft::swap(this->_sz, x._sz);
+				ft::swap(this->_committed, x._committed);
+				ft::swap(this->_reserved, x._reserved);
+			}
+			/* -------------------------------------------------------------------------- */
+
+		private:
+			/* ----------------------------- Internal helpers ---------------------------- */
+			static size_type _page_size(void) {
+				static const size_type page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+				return page;
+			}
+			static size_type _round_to_page(size_type bytes) {
+				return (bytes + _page_size() - 1) & ~(_page_size() - 1);
+			}
+			void _reserve_address_space(size_type max_elements) {
+				if (max_elements > std::numeric_limits<size_type>::max() / sizeof(value_type) - _page_size())
+					throw vm_vector::LengthError();
+				size_type bytes = _round_to_page(max_elements * sizeof(value_type));
+				if (bytes == 0)
+					bytes = _page_size();
+
+				int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+			# ifdef MAP_NORESERVE
+				flags |= MAP_NORESERVE;
+			# endif
+				void *addr = ::mmap(nullptr, bytes, PROT_NONE, flags, -1, 0);
+				if (addr == MAP_FAILED)
+					throw std::bad_alloc();
+				this->_begin = static_cast<pointer>(addr);
+				this->_reserved = bytes;
+			}
+			// Commits at least bytes, growing the committed part geometrically so that
+			// a run of push_backs costs O(log n) mprotect calls.
+			void _commit(size_type bytes) {
+				size_type target = this->_committed * 2;
+				if (target < bytes)
+					target = bytes;
+				target = _round_to_page(target);
+				if (target > this->_reserved)
+					target = this->_reserved;
+
+				char *from = reinterpret_cast<char *>(this->_begin) + this->_committed;
+				if (::mprotect(from, target - this->_committed, PROT_READ | PROT_WRITE) != 0)
+					throw std::bad_alloc();
+				this->_committed = target;
+			}
+			/* -------------------------------------------------------------------------- */
+
+		public:
+		class LengthError: public std::exception {
+			const char* what() const throw() {
+				return "vm_vector";
+			}
+		};
+
+		class Out_of_range : public std::exception {
+			const char*  what() const throw() {
+				return "vm_vector";
+			}
+		};
+	};
+
+	template <class T>
+	inline bool operator== (const ft::vm_vector<T>& lhs, const ft::vm_vector<T>& rhs) {
+		if (lhs.size() == rhs.size())
+			return ft::equal(lhs.data(), lhs.data() + lhs.size(), rhs.data());
+		return false;
+	}
+
+	template <class T>
+	inline bool operator!=(const ft::vm_vector<T>& lhs, const ft::vm_vector<T>& rhs) {return !(rhs == lhs);}
+}
+
+#endif
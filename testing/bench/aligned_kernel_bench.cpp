@@ -0,0 +1,66 @@
+#include <vector>
+#include <string>
+
+#include "ft_vector.hpp"
+#include "aligned_allocator.hpp"
+#include "bench.hpp"
+
+// SIMD kernels over float buffers that sit in L1, where alignment is what
+// separates them: a misaligned 32-byte load that crosses a cache line costs
+// two. The kernels are built for AVX2 + FMA and run only where the CPU has it.
+//	• unaligned: a std::allocator buffer read from its second float, so every
+//	  32-byte load straddles a 16-byte boundary and one in two crosses a line;
+//	• default:   the std::allocator buffer as is, 16-byte aligned;
+//	• aligned:   ft::aligned_allocator<float, 64> through data(), which the
+//	  compiler knows is 64-byte aligned.
+
+static const size_t ELEMS = 4096;
+static const size_t ROUNDS = 200000;
+
+// gcc only vectorizes loops that need no run-time checks at -O2; clang does.
+#if defined(__GNUC__) && !defined(__clang__)
+# define KERNEL __attribute__((target("avx2,fma"), optimize("O3"), noinline))
+#else
+# define KERNEL __attribute__((target("avx2,fma"), noinline))
+#endif
+
+// Raw pointers: the compiler knows nothing of their alignment.
+KERNEL void saxpy(float a, const float * __restrict x, float * __restrict y, size_t n) {
+	for (size_t i = 0; i < n; ++i)
+		y[i] = a * x[i] + y[i];
+}
+
+// Through data(): with aligned_allocator the compiler sees the alignment.
+template <class Vec>
+KERNEL void saxpy(float a, Vec const & xv, Vec & yv) {
+	const float * __restrict x = xv.data();
+	float * __restrict y = yv.data();
+	for (size_t i = 0; i < ELEMS; ++i)
+		y[i] = a * x[i] + y[i];
+}
+
+template <class Kernel>
+void run(std::string const & name, Kernel kernel) {
+	Timer t;
+	for (size_t r = 0; r < ROUNDS; ++r)
+		kernel(1.0001f);
+	report(name, t.seconds(), ROUNDS * ELEMS);
+}
+
+int main(void) {
+	if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma")) {
+		std::cout << "\nno AVX2/FMA on this CPU, skipping" << std::endl;
+		return 0;
+	}
+	std::cout << "\nsaxpy over " << ELEMS << " floats, " << ROUNDS << " rounds\n" << std::endl;
+
+	ft::vector<float> x(ELEMS + 1, 1.0f);
+	ft::vector<float> y(ELEMS + 1, 2.0f);
+	ft::vector<float, ft::aligned_allocator<float, 64> > ax(ELEMS, 1.0f);
+	ft::vector<float, ft::aligned_allocator<float, 64> > ay(ELEMS, 2.0f);
+
+	run("unaligned (+4 B)", [&x, &y](float a) {saxpy(a, x.data() + 1, y.data() + 1, ELEMS); do_not_optimize(y[1]);});
+	run("default (std::allocator)", [&x, &y](float a) {saxpy(a, x, y); do_not_optimize(y[0]);});
+	run("aligned_allocator<64>", [&ax, &ay](float a) {saxpy(a, ax, ay); do_not_optimize(ay[0]);});
+	return 0;
+}
@@ -0,0 +1,40 @@
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+/* --------------------------------- Headers -------------------------------- */
+# include <chrono>
+# include <iostream>
+# include <iomanip>
+# include <string>
+/* -------------------------------------------------------------------------- */
+
+/* ------------------------------ Bench helpers ----------------------------- */
+class Timer {
+	public:
+		Timer() : start_(clock::now()) {}
+
+		void reset() { this->start_ = clock::now(); }
+
+		double seconds() const {
+			return std::chrono::duration<double>(clock::now() - this->start_).count();
+		}
+
+	private:
+		typedef std::chrono::steady_clock clock;
+		clock::time_point start_;
+};
+
+// Keeps the optimizer from throwing away a computed value.
+template <typename T>
+inline void do_not_optimize(T const & val) {
+	asm volatile("" : : "r,m"(val) : "memory");
+}
+
+inline void report(std::string const & name, double seconds, double ops) {
+	std::cout << std::left << std::setw(40) << name
+		<< std::right << std::setw(12) << std::fixed << std::setprecision(3) << seconds * 1000 << " ms"
+		<< std::setw(16) << std::setprecision(0) << ops / seconds << " ops/s" << std::endl;
+}
+/* -------------------------------------------------------------------------- */
+
+#endif
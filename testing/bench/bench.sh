@@ -0,0 +1,17 @@
+#! /bin/zsh
+
+# Usage: zsh bench.sh [name ...]   (runs every *_bench.cpp when no name is given)
+
+rm -rf logs
+mkdir logs
+
+benches=($@)
+if [ ${#benches} -eq 0 ]; then
+	benches=(*_bench.cpp)
+	benches=(${benches%_bench.cpp})
+fi
+
+for bench in $benches; do
+	clang++ -O2 -Wall -Wextra -Werror -I ../../impliment -I ../../utils -I ../ ./${bench}_bench.cpp -o logs/${bench} &&
+	./logs/${bench} || exit 1
+done
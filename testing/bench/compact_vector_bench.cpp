@@ -0,0 +1,52 @@
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+#include "ft_vector.hpp"
+#include "ft_compact_vector.hpp"
+#include "bench.hpp"
+
+// A sparse adjacency list: millions of inner vectors, most of them holding
+// a handful of edges. The outer array of vector headers is a large part of
+// the footprint, and it is what a traversal streams through.
+
+static const size_t NODES = 4000000;
+
+template <class Inner>
+void adjacency(std::string const & name) {
+	std::srand(42);
+	Timer t;
+	std::vector<Inner> graph(NODES);
+	size_t edges = 0;
+	for (size_t u = 0; u < NODES; ++u) {
+		size_t degree = std::rand() % 4;
+		for (size_t i = 0; i < degree; ++i)
+			graph[u].push_back(static_cast<int>(std::rand() % NODES));
+		edges += degree;
+	}
+	report(name + " build", t.seconds(), NODES);
+
+	t.reset();
+	long sum = 0;
+	for (size_t round = 0; round < 10; ++round)
+		for (size_t u = 0; u < NODES; ++u)
+			for (size_t i = 0; i < graph[u].size(); ++i)
+				sum += graph[u][i];
+	do_not_optimize(sum);
+	report(name + " traverse x10", t.seconds(), 10 * NODES);
+
+	size_t heap = 0;
+	for (size_t u = 0; u < NODES; ++u)
+		heap += graph[u].capacity() * sizeof(int);
+	std::cout << "    header " << sizeof(Inner) << " B, headers " << sizeof(Inner) * NODES / (1 << 20)
+		<< " MB, edge buffers " << heap / (1 << 20) << " MB, " << edges << " edges" << std::endl;
+}
+
+int main(void) {
+	std::cout << "\nadjacency list, " << NODES << " nodes, 0-3 edges each\n" << std::endl;
+
+	adjacency<ft::vector<int> >("ft  vector        ");
+	adjacency<ft::compact_vector<int> >("ft  compact_vector");
+	adjacency<std::vector<int> >("std vector        ");
+	return 0;
+}
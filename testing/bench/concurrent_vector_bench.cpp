@@ -0,0 +1,62 @@
+#include <vector>
+#include <string>
+#include <thread>
+#include <mutex>
+
+#include "ft_vector.hpp"
+#include "ft_concurrent_vector.hpp"
+#include "bench.hpp"
+
+// Many threads appending to one shared vector. The locked vectors serialize
+// every push and stall everyone while one of them reallocates; the
+// concurrent_vector takes one fetch_add per push and never moves an element.
+// The total number of pushes stays fixed while the thread count grows.
+
+static const size_t PUSHES = 1 << 22;
+
+template <class Push>
+void run(std::string const & name, size_t threads, Push push) {
+	std::vector<std::thread> workers;
+	Timer t;
+	for (size_t k = 0; k < threads; ++k)
+		workers.push_back(std::thread([&push, threads, k] {
+			for (size_t i = k; i < PUSHES; i += threads)
+				push(static_cast<long>(i));
+		}));
+	for (size_t k = 0; k < workers.size(); ++k)
+		workers[k].join();
+	report(name + " x" + std::to_string(threads), t.seconds(), PUSHES);
+}
+
+int main(void) {
+	std::cout << "\n" << PUSHES << " push_back calls of a long, shared by 1-64 threads"
+		<< " (" << std::thread::hardware_concurrency() << " hardware threads)\n" << std::endl;
+
+	for (size_t threads = 1; threads <= 64; threads *= 2) {
+		{
+			ft::concurrent_vector<long> vec;
+			run("ft  concurrent_vector", threads, [&vec](long v) {vec.push_back(v);});
+			do_not_optimize(vec[vec.size() - 1]);
+		}
+		{
+			std::mutex lock;
+			ft::vector<long> vec;
+			run("ft  vector + mutex", threads, [&vec, &lock](long v) {
+				std::lock_guard<std::mutex> guard(lock);
+				vec.push_back(v);
+			});
+			do_not_optimize(vec.back());
+		}
+		{
+			std::mutex lock;
+			std::vector<long> vec;
+			run("std vector + mutex", threads, [&vec, &lock](long v) {
+				std::lock_guard<std::mutex> guard(lock);
+				vec.push_back(v);
+			});
+			do_not_optimize(vec.back());
+		}
+		std::cout << std::endl;
+	}
+	return 0;
+}
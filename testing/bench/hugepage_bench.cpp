@@ -0,0 +1,57 @@
+#include <cstdlib>
+#include <fstream>
+#include <stdint.h>
+
+#include "ft_vector.hpp"
+#include "hugepage_allocator.hpp"
+#include "bench.hpp"
+
+// Sequential and random scans over a multi-GB ft::vector, with the default
+// allocator and with ft::hugepage_allocator. Random gathers are where TLB
+// misses hurt, so that is where huge pages should show.
+//
+// Usage: ./hugepage [megabytes]   (default: 2048)
+
+static const size_t GATHERS = 50000000;
+
+template <class Vec>
+void scan(std::string const & name, size_t count) {
+	Vec vec(count, 1);
+	for (size_t i = 0; i < count; ++i)
+		vec[i] = i;
+
+	uint64_t sum = 0;
+	Timer t;
+	for (size_t i = 0; i < count; ++i)
+		sum += vec[i];
+	double sec = t.seconds();
+	do_not_optimize(sum);
+	report(name + " sequential", sec, count);
+
+	uint64_t x = 88172645463325252ull;
+	t.reset();
+	for (size_t i = 0; i < GATHERS; ++i) {
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		sum += vec[x % count];
+	}
+	sec = t.seconds();
+	do_not_optimize(sum);
+	report(name + " random", sec, GATHERS);
+}
+
+int main(int argc, char **argv) {
+	size_t mb = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : 2048;
+	size_t count = (mb << 20) / sizeof(uint64_t);
+
+	std::ifstream thp("/sys/kernel/mm/transparent_hugepage/enabled");
+	std::string mode;
+	if (std::getline(thp, mode))
+		std::cout << "\ntransparent_hugepage: " << mode << std::endl;
+	std::cout << "\nscan of " << mb << " MB of uint64_t\n" << std::endl;
+
+	scan<ft::vector<uint64_t> >("std::allocator    ", count);
+	scan<ft::vector<uint64_t, ft::hugepage_allocator<uint64_t> > >("hugepage_allocator", count);
+	return 0;
+}
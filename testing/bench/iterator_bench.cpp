@@ -0,0 +1,61 @@
+#include <vector>
+#include <string>
+#include <numeric>
+#include <type_traits>
+
+#include "ft_vector.hpp"
+#include "bench.hpp"
+
+// Iterating an ft::vector through its iterators must cost what a raw pointer
+// loop costs. The out-of-line sums take their iterators by value: a trivially
+// copyable one-pointer iterator arrives in a register, exactly like a pointer.
+
+static_assert(std::is_trivially_copyable<ft::vector<int>::iterator>::value, "iterator is not trivially copyable");
+static_assert(std::is_trivially_copyable<ft::vector<int>::reverse_iterator>::value, "reverse_iterator is not trivially copyable");
+
+static const size_t ELEMS = 1 << 16;
+static const size_t ROUNDS = 20000;
+
+template <class It>
+__attribute__((noinline)) long sum_range(It first, It last) {
+	long sum = 0;
+	for (; first != last; ++first)
+		sum += *first;
+	return sum;
+}
+
+template <class Sum>
+void run(std::string const & name, Sum sum) {
+	long total = 0;
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		total += sum();
+		do_not_optimize(total);
+	}
+	report(name, t.seconds(), ROUNDS * ELEMS);
+}
+
+int main(void) {
+	std::cout << "\nsumming " << ELEMS << " ints, " << ROUNDS << " rounds\n" << std::endl;
+
+	ft::vector<int> vec(ELEMS, 1);
+	std::vector<int> std_vec(ELEMS, 1);
+	const int * raw = &vec[0];
+
+	run("raw pointer loop", [raw] {return sum_range(raw, raw + ELEMS);});
+	run("ft  vector iterator", [&vec] {return sum_range(vec.begin(), vec.end());});
+	run("ft  vector const_iterator", [&vec] {
+		ft::vector<int> const & cvec = vec;
+		return sum_range(cvec.begin(), cvec.end());
+	});
+	run("ft  vector reverse_iterator", [&vec] {return sum_range(vec.rbegin(), vec.rend());});
+	run("ft  vector operator[]", [&vec] {
+		long sum = 0;
+		for (size_t i = 0; i < vec.size(); ++i)
+			sum += vec[i];
+		return sum;
+	});
+	run("ft  std::accumulate", [&vec] {return std::accumulate(vec.begin(), vec.end(), 0L);});
+	run("std vector iterator", [&std_vec] {return sum_range(std_vec.begin(), std_vec.end());});
+	return 0;
+}
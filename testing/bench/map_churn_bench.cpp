@@ -0,0 +1,77 @@
+#include <map>
+#include <vector>
+#include <string>
+#include <thread>
+#include <utility>
+#include <cstdint>
+
+#include "ft_map.hpp"
+#include "pool_allocator.hpp"
+#include "bench.hpp"
+
+// Insert/erase churn on a map of steady size: every step erases one key and
+// inserts another, so each step frees and allocates a node and a value. The
+// threaded rounds give every thread its own map, which is where malloc's
+// shared state and the pool's thread caches differ most.
+
+static const int LIVE = 100000;
+static const size_t STEPS = 1000000;
+
+static inline uint64_t next(uint64_t & s) {
+	s ^= s << 13;
+	s ^= s >> 7;
+	s ^= s << 17;
+	return s;
+}
+
+template <class Map>
+long churn(uint64_t seed) {
+	Map m;
+	uint64_t s = seed;
+	std::vector<int> keys;
+	for (int i = 0; i < LIVE; ++i) {
+		int k = static_cast<int>(next(s) >> 33);
+		if (m.insert(std::make_pair(k, i)).second)
+			keys.push_back(k);
+	}
+	for (size_t i = 0; i < STEPS; ++i) {
+		size_t victim = next(s) % keys.size();
+		m.erase(keys[victim]);
+		int k = static_cast<int>(next(s) >> 33);
+		if (m.insert(std::make_pair(k, static_cast<int>(i))).second)
+			keys[victim] = k;
+		else {
+			keys[victim] = keys.back();
+			keys.pop_back();
+		}
+	}
+	return static_cast<long>(m.size());
+}
+
+template <class Map>
+void run(std::string const & name, size_t threads) {
+	std::vector<std::thread> workers;
+	std::vector<long> sizes(threads);
+	Timer t;
+	for (size_t k = 0; k < threads; ++k)
+		workers.push_back(std::thread([&sizes, k] {sizes[k] = churn<Map>(88172645463325252ULL + k);}));
+	for (size_t k = 0; k < threads; ++k)
+		workers[k].join();
+	do_not_optimize(sizes[0]);
+	report(name + " x" + std::to_string(threads), t.seconds(), threads * STEPS);
+}
+
+typedef std::pair<const int, int> entry;
+
+int main(void) {
+	std::cout << "\n" << LIVE << " live keys, " << STEPS << " erase+insert steps per thread\n" << std::endl;
+
+	for (size_t threads = 1; threads <= 4; threads *= 4) {
+		run<ft::map<int, int> >("ft  map, std::allocator ", threads);
+		run<ft::map<int, int, ft::less<int>, ft::pool_allocator<entry> > >("ft  map, pool_allocator", threads);
+		run<std::map<int, int> >("std map, std::allocator ", threads);
+		run<std::map<int, int, std::less<int>, ft::pool_allocator<entry> > >("std map, pool_allocator", threads);
+		std::cout << std::endl;
+	}
+	return 0;
+}
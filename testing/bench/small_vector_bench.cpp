@@ -0,0 +1,59 @@
+#include <vector>
+#include <cstdlib>
+#include <new>
+
+#include "ft_vector.hpp"
+#include "ft_small_vector.hpp"
+#include "bench.hpp"
+
+// Short-lived per-request vectors: build one with a handful of elements, read
+// it, drop it. Reports heap allocations per request and request latency.
+
+static size_t g_allocations = 0;
+
+void *operator new(std::size_t size) {
+	g_allocations++;
+	if (void *p = std::malloc(size))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+static const size_t REQUESTS = 5000000;
+
+template <class Vec>
+void requests(std::string const & name, size_t max_len) {
+	size_t allocs = g_allocations;
+	long sum = 0;
+
+	Timer t;
+	for (size_t r = 0; r < REQUESTS; ++r) {
+		Vec vec;
+		size_t len = (r * 7) % (max_len + 1);
+		for (size_t i = 0; i < len; ++i)
+			vec.push_back(static_cast<int>(r + i));
+		for (size_t i = 0; i < vec.size(); ++i)
+			sum += vec[i];
+	}
+	double sec = t.seconds();
+	do_not_optimize(sum);
+
+	report(name, sec, REQUESTS);
+	std::cout << "    " << std::setprecision(2) << static_cast<double>(g_allocations - allocs) / REQUESTS
+		<< " allocations/request, " << std::setprecision(1) << sec * 1e9 / REQUESTS << " ns/request" << std::endl;
+}
+
+int main(void) {
+	std::cout << "\n" << REQUESTS << " requests, up to 8 elements each\n" << std::endl;
+	requests<ft::vector<int> >("ft  vector", 8);
+	requests<std::vector<int> >("std vector", 8);
+	requests<ft::small_vector<int, 8> >("ft  small_vector<8>", 8);
+
+	std::cout << "\n" << REQUESTS << " requests, up to 16 elements each\n" << std::endl;
+	requests<ft::vector<int> >("ft  vector", 16);
+	requests<std::vector<int> >("std vector", 16);
+	requests<ft::small_vector<int, 8> >("ft  small_vector<8>", 16);
+	return 0;
+}
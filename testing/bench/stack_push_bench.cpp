@@ -0,0 +1,49 @@
+#include <vector>
+#include <deque>
+#include <stack>
+#include <string>
+#include <algorithm>
+#include <chrono>
+
+#include "ft_stack.hpp"
+#include "bench.hpp"
+
+// Latency of each single push, not the average: a vector-backed stack is
+// cheap on average but every reallocation copies the whole stack, which shows
+// up at the tail. A deque-backed stack only ever allocates one chunk.
+
+static const size_t PUSHES = 4000000;
+
+template <class Stack>
+void push_latency(std::string const & name) {
+	typedef std::chrono::steady_clock clock;
+	std::vector<long long> samples(PUSHES);
+	Stack st;
+
+	Timer t;
+	for (size_t i = 0; i < PUSHES; ++i) {
+		clock::time_point before = clock::now();
+		st.push(static_cast<int>(i));
+		clock::time_point after = clock::now();
+		samples[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count();
+	}
+	double sec = t.seconds();
+	do_not_optimize(st.top());
+
+	std::sort(samples.begin(), samples.end());
+	report(name, sec, PUSHES);
+	std::cout << "    p50 " << samples[PUSHES / 2] << " ns"
+		<< "   p99 " << samples[PUSHES / 100 * 99] << " ns"
+		<< "   p99.9 " << samples[PUSHES / 1000 * 999] << " ns"
+		<< "   max " << samples[PUSHES - 1] << " ns" << std::endl;
+}
+
+int main(void) {
+	std::cout << "\nstack push latency, " << PUSHES << " pushes\n" << std::endl;
+
+	push_latency<ft::stack<int> >("ft  stack<int> (deque)");
+	push_latency<ft::stack<int, ft::vector<int> > >("ft  stack<int, vector>");
+	push_latency<std::stack<int> >("std stack<int> (deque)");
+	push_latency<std::stack<int, std::vector<int> > >("std stack<int, vector>");
+	return 0;
+}
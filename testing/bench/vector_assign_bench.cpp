@@ -0,0 +1,81 @@
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+#include "ft_vector.hpp"
+#include "bench.hpp"
+
+// A scratch vector reassigned in a hot loop from sources of varying size.
+// Once the scratch buffer has grown to the largest source, copy assignment
+// and assign() should stop allocating; for strings, assigning over the live
+// elements also reuses their character buffers.
+
+static const size_t SOURCES = 64;
+static const size_t ROUNDS = 2000000;
+
+template <class Vec>
+void copy_assign(std::string const & name, std::vector<Vec> const & sources) {
+	Vec scratch;
+
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		scratch = sources[i % SOURCES];
+		do_not_optimize(scratch.size());
+	}
+	double sec = t.seconds();
+	report(name + " operator=", sec, ROUNDS);
+
+	t.reset();
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		Vec const & src = sources[i % SOURCES];
+		scratch.assign(src.begin(), src.end());
+		do_not_optimize(scratch.size());
+	}
+	sec = t.seconds();
+	report(name + " assign(first, last)", sec, ROUNDS);
+}
+
+template <class Vec>
+void fill_assign(std::string const & name, typename Vec::value_type const & val) {
+	Vec scratch;
+
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		scratch.assign(i % 128, val);
+		do_not_optimize(scratch.size());
+	}
+	double sec = t.seconds();
+	report(name + " assign(n, val)", sec, ROUNDS);
+}
+
+template <class Vec>
+std::vector<Vec> make_sources(typename Vec::value_type (*make)(size_t)) {
+	std::vector<Vec> sources;
+	std::srand(42);
+	for (size_t i = 0; i < SOURCES; ++i) {
+		Vec src;
+		size_t n = std::rand() % 128;
+		for (size_t j = 0; j < n; ++j)
+			src.push_back(make(j));
+		sources.push_back(src);
+	}
+	return sources;
+}
+
+static int make_int(size_t i) {return static_cast<int>(i);}
+static std::string make_string(size_t i) {return std::string(i % 40, 'a' + i % 26);}
+
+int main(void) {
+	std::cout << "\nrepeated assignment, " << ROUNDS << " rounds, sources of 0-127 elements\n" << std::endl;
+
+	copy_assign("ft  int   ", make_sources<ft::vector<int> >(make_int));
+	copy_assign("std int   ", make_sources<std::vector<int> >(make_int));
+	copy_assign("ft  string", make_sources<ft::vector<std::string> >(make_string));
+	copy_assign("std string", make_sources<std::vector<std::string> >(make_string));
+
+	fill_assign<ft::vector<int> >("ft  int   ", 7);
+	fill_assign<std::vector<int> >("std int   ", 7);
+	fill_assign<ft::vector<std::string> >("ft  string", std::string(24, 's'));
+	fill_assign<std::vector<std::string> >("std string", std::string(24, 's'));
+	return 0;
+}
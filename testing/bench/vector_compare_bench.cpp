@@ -0,0 +1,52 @@
+#include <vector>
+#include <stdint.h>
+
+#include "ft_vector.hpp"
+#include "bench.hpp"
+
+// operator== and operator< on equal-prefix vectors: the only difference is in
+// the last element, so every comparison walks the whole buffer.
+// 1 MB of bytes goes straight to memcmp; ints are skipped block by block with
+// memcmp and only the block that differs is compared element-wise.
+
+static const size_t BYTES = 1 << 20;
+static const size_t INTS = BYTES / sizeof(int);
+static const size_t ROUNDS = 2000;
+
+template <class Vec>
+void compare(std::string const & name, size_t count) {
+	Vec lhs(count, 7);
+	Vec rhs(count, 7);
+	rhs[count - 1] = 8;
+
+	size_t hits = 0;
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		do_not_optimize(lhs);
+		hits += (lhs == rhs);
+	}
+	double sec = t.seconds();
+	do_not_optimize(hits);
+	report(name + " ==", sec, ROUNDS);
+
+	t.reset();
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		do_not_optimize(lhs);
+		hits += (lhs < rhs);
+	}
+	sec = t.seconds();
+	do_not_optimize(hits);
+	report(name + " <", sec, ROUNDS);
+}
+
+int main(void) {
+	std::cout << "\nvector comparison, 1 MB per vector, " << ROUNDS << " rounds\n" << std::endl;
+
+	compare<ft::vector<unsigned char> >("ft  bytes", BYTES);
+	compare<std::vector<unsigned char> >("std bytes", BYTES);
+	compare<ft::vector<int> >("ft  int", INTS);
+	compare<std::vector<int> >("std int", INTS);
+	compare<ft::vector<uint64_t> >("ft  uint64", BYTES / sizeof(uint64_t));
+	compare<std::vector<uint64_t> >("std uint64", BYTES / sizeof(uint64_t));
+	return 0;
+}
@@ -0,0 +1,57 @@
+#include <vector>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "ft_vector.hpp"
+#include "bench.hpp"
+
+// push_back throughput and peak RSS for every growth policy. Each policy runs
+// in its own child process so that the peaks do not mask each other.
+//
+// Usage: ./vector_growth [elements]   (default: 64M ints, 256 MB of payload)
+
+static size_t peak_rss_kb(void) {
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+# if defined(__APPLE__)
+	return usage.ru_maxrss / 1024;
+# else
+	return usage.ru_maxrss;
+# endif
+}
+
+template <class Vec>
+void grow(std::string const & name, size_t count) {
+	pid_t pid = fork();
+	if (pid != 0) {
+		waitpid(pid, NULL, 0);
+		return;
+	}
+
+	Timer t;
+	Vec vec;
+	for (size_t i = 0; i < count; ++i)
+		vec.push_back(static_cast<int>(i));
+	double sec = t.seconds();
+	do_not_optimize(vec[count / 2]);
+
+	report(name, sec, count);
+	std::cout << "    peak rss " << peak_rss_kb() / 1024 << " MB, capacity "
+		<< vec.capacity() << " (" << (vec.capacity() - vec.size()) * sizeof(int) / 1024 << " KB slack)" << std::endl;
+	std::exit(0);
+}
+
+int main(int argc, char **argv) {
+	size_t count = (argc > 1) ? std::strtoul(argv[1], NULL, 10) : 64u << 20;
+
+	std::cout << "\npush_back of " << count << " ints\n" << std::endl;
+
+	grow<ft::vector<int, std::allocator<int>, ft::double_growth> >("ft  double_growth", count);
+	grow<ft::vector<int, std::allocator<int>, ft::one_and_half_growth> >("ft  one_and_half_growth", count);
+	grow<ft::vector<int, std::allocator<int>, ft::size_class_growth<> > >("ft  size_class_growth", count);
+	grow<ft::vector<int, std::allocator<int>, ft::size_class_growth<ft::double_growth> > >("ft  size_class_growth<double>", count);
+	grow<std::vector<int> >("std vector", count);
+	return 0;
+}
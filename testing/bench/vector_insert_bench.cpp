@@ -0,0 +1,52 @@
+#include <vector>
+#include <cstdlib>
+
+#include "ft_vector.hpp"
+#include "bench.hpp"
+
+// Mid-vector insert throughput: every insert lands in the middle of a vector
+// of one million ints, so the cost is dominated by how the tail is shifted.
+
+static const size_t BASE = 1000000;
+static const size_t ROUNDS = 200;
+
+template <class Vec>
+void fill_insert(std::string const & name, size_t n) {
+	Vec vec(BASE, 1);
+	vec.reserve(BASE + ROUNDS * n);
+
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i)
+		vec.insert(vec.begin() + vec.size() / 2, n, static_cast<int>(i));
+	double sec = t.seconds();
+	do_not_optimize(vec[vec.size() / 2]);
+	report(name, sec, ROUNDS);
+}
+
+template <class Vec>
+void range_insert(std::string const & name, size_t n) {
+	Vec vec(BASE, 1);
+	Vec src(n, 2);
+
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i)
+		vec.insert(vec.begin() + vec.size() / 2, src.begin(), src.end());
+	double sec = t.seconds();
+	do_not_optimize(vec[vec.size() / 2]);
+	report(name, sec, ROUNDS);
+}
+
+int main(void) {
+	std::cout << "\nmid-vector insert, " << BASE << " ints, " << ROUNDS << " inserts\n" << std::endl;
+
+	fill_insert<ft::vector<int> >("ft  fill  insert n=1", 1);
+	fill_insert<std::vector<int> >("std fill  insert n=1", 1);
+	fill_insert<ft::vector<int> >("ft  fill  insert n=64", 64);
+	fill_insert<std::vector<int> >("std fill  insert n=64", 64);
+
+	range_insert<ft::vector<int> >("ft  range insert n=64", 64);
+	range_insert<std::vector<int> >("std range insert n=64", 64);
+	range_insert<ft::vector<int> >("ft  range insert n=4096", 4096);
+	range_insert<std::vector<int> >("std range insert n=4096", 4096);
+	return 0;
+}
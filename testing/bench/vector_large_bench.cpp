@@ -0,0 +1,56 @@
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "ft_vector.hpp"
+#include "bench.hpp"
+
+// Byte vectors past 4 GB, where indices and iterator differences no longer
+// fit in 32 bits. One vector lives at a time; it needs about LARGE_ELEMS
+// bytes of RAM (build with -DLARGE_ELEMS=... to scale).
+
+#ifndef LARGE_ELEMS
+# define LARGE_ELEMS ((size_t(1) << 32) + 4096)
+#endif
+
+template <class Vec>
+void large(std::string const & name) {
+	Timer t;
+	Vec vec;
+	vec.reserve(LARGE_ELEMS + 16);
+	vec.resize(LARGE_ELEMS, 'a');
+	report(name + " fill", t.seconds(), LARGE_ELEMS);
+
+	t.reset();
+	size_t n = 0;
+	for (typename Vec::const_iterator it = vec.begin(); it != vec.end(); ++it)
+		n += *it == 'a';
+	do_not_optimize(n);
+	report(name + " iterate", t.seconds(), LARGE_ELEMS);
+
+	t.reset();
+	typename Vec::iterator pos = std::find(vec.begin() + (LARGE_ELEMS - 64), vec.end(), 'a');
+	do_not_optimize(pos);
+	report(name + " find past 2^32", t.seconds(), 1);
+
+	t.reset();
+	vec.insert(vec.begin() + 1, 8, 'b');
+	report(name + " insert at front", t.seconds(), LARGE_ELEMS);
+
+	t.reset();
+	vec.erase(vec.begin() + 1, vec.begin() + 9);
+	report(name + " erase at front", t.seconds(), LARGE_ELEMS);
+
+	t.reset();
+	vec.insert(vec.end() - 4, 8, 'c');
+	vec.erase(vec.end() - 12, vec.end() - 4);
+	report(name + " insert/erase at back", t.seconds(), 1);
+}
+
+int main(void) {
+	std::cout << "\nbyte vector of " << LARGE_ELEMS << " elements\n" << std::endl;
+
+	large<ft::vector<char> >("ft  vector<char>");
+	large<std::vector<char> >("std vector<char>");
+	return 0;
+}
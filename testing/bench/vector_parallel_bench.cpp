@@ -0,0 +1,45 @@
+#include <vector>
+#include <string>
+#include <thread>
+
+#include "ft_vector.hpp"
+#include "bench.hpp"
+
+// Filling and copying a vector of a few hundred MB on one thread versus
+// ft::par. Every run starts from a fresh buffer, so page faults are part of
+// the cost, the same as in a real program building a large table.
+
+static const size_t ELEMS = 1 << 25; // 256 MB of long
+static const size_t ROUNDS = 4;
+
+template <class Make>
+void run(std::string const & name, Make make) {
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		ft::vector<long> vec = make();
+		do_not_optimize(vec[vec.size() - 1]);
+	}
+	report(name, t.seconds(), ROUNDS * ELEMS);
+}
+
+int main(void) {
+	std::cout << "\nlarge vector construction, " << ELEMS * sizeof(long) / (1 << 20) << " MB, "
+		<< std::thread::hardware_concurrency() << " hardware threads\n" << std::endl;
+
+	ft::vector<long> src(ft::par, ELEMS, 3);
+
+	run("ft  vector(n, val)", [] {return ft::vector<long>(ELEMS, 7);});
+	run("ft  vector(par, n, val)", [] {return ft::vector<long>(ft::par, ELEMS, 7);});
+	run("ft  vector(x)", [&src] {return ft::vector<long>(src);});
+	run("ft  vector(par, x)", [&src] {return ft::vector<long>(ft::par, src);});
+	run("ft  assign(n, val)", [] {ft::vector<long> vec; vec.assign(ELEMS, 7); return vec;});
+	run("ft  assign(par, n, val)", [] {ft::vector<long> vec; vec.assign(ft::par, ELEMS, 7); return vec;});
+
+	Timer t;
+	for (size_t i = 0; i < ROUNDS; ++i) {
+		std::vector<long> vec(ELEMS, 7);
+		do_not_optimize(vec[vec.size() - 1]);
+	}
+	report("std vector(n, val)", t.seconds(), ROUNDS * ELEMS);
+	return 0;
+}
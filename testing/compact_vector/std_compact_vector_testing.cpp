@@ -0,0 +1,155 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include "testing.hpp"
+
+// compact_vector must behave like a vector; its growth is not part of the
+// contract, so capacity is not printed.
+
+void print(const std::vector<Test> & vec) {
+	std::cout << "size    : " << vec.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < vec.size(); ++i) {
+		if (i != 0 && i % 32 == 0)
+			std::cout << std::endl;
+		std::cout << vec[i].some_ << " ";
+	}
+	std::cout << std::endl;
+}
+
+void ft_modifiers_test() {
+	std::cout << "\nmodifiers\n" << std::endl;
+	std::vector<Test> vec;
+
+	std::cout << vec.empty() << std::endl;
+	for (int i = 0; i < 40; ++i)
+		vec.push_back(i);
+	vec.emplace_back(40);
+	print(vec);
+	vec.insert(vec.begin() + 3, 5, 42);
+	vec.insert(vec.begin(), Test(-1));
+	print(vec);
+	vec.erase(vec.begin(), vec.begin() + 10);
+	vec.erase(vec.end() - 1);
+	print(vec);
+	vec.resize(50, 7);
+	print(vec);
+	vec.resize(2);
+	print(vec);
+	vec.pop_back();
+	std::cout << vec.front().some_ << " " << vec.back().some_ << std::endl;
+	try {
+		vec.at(10);
+	} catch (std::exception & e) {
+		std::cout << "out of range" << std::endl;
+	}
+	vec.clear();
+	print(vec);
+}
+
+void ft_copy_move_test() {
+	std::cout << "\ncopy_move\n" << std::endl;
+	std::vector<Test> small(4, 1);
+	std::vector<Test> big(40, 2);
+
+	std::vector<Test> small_copy(small);
+	std::vector<Test> big_copy(big);
+	print(small_copy);
+	print(big_copy);
+
+	std::vector<Test> small_moved(std::move(small_copy));
+	std::vector<Test> big_moved(std::move(big_copy));
+	print(small_moved);
+	print(big_moved);
+	std::cout << small_copy.size() << " " << big_copy.size() << std::endl;
+
+	small_moved = big;
+	big_moved = small;
+	print(small_moved);
+	print(big_moved);
+
+	small_moved.swap(big_moved);
+	print(small_moved);
+	print(big_moved);
+
+	small_moved.assign(big.begin() + 5, big.end() - 30);
+	print(small_moved);
+	small_moved.assign(3, 9);
+	print(small_moved);
+
+	std::vector<int> lhs(3, 1);
+	std::vector<int> rhs(12, 1);
+	std::cout << (lhs == rhs) << (lhs < rhs) << (rhs <= lhs) << (lhs != rhs) << std::endl;
+}
+
+void ft_strings_test() {
+	std::cout << "\nstrings\n" << std::endl;
+	std::vector<std::string> words;
+
+	for (size_t i = 0; i < 30; ++i)
+		words.push_back(std::string(i % 12 + 1, 'a' + i % 26));
+	words.insert(words.begin() + 2, words[10]);
+	words.insert(words.begin() + 4, words.begin() + 20, words.begin() + 25);
+	words.erase(words.begin() + 5);
+	for (size_t i = 0; i < words.size(); ++i)
+		std::cout << words[i] << " ";
+	std::cout << std::endl;
+	for (std::vector<std::string>::reverse_iterator it = words.rbegin(); it != words.rend(); ++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+}
+
+// An adjacency list: the use case the type is for.
+void ft_nested_test() {
+	std::cout << "\nnested\n" << std::endl;
+	std::vector<std::vector<int> > graph(1000);
+
+	for (int u = 0; u < 1000; ++u)
+		for (int v = u + 1; v < 1000; v += u % 17 + 1)
+			graph[u].push_back(v);
+	for (int u = 0; u < 1000; u += 3)
+		graph[u].shrink_to_fit();
+	graph.resize(2000);
+	graph.erase(graph.begin() + 100, graph.begin() + 200);
+
+	long edges = 0;
+	long weight = 0;
+	for (size_t u = 0; u < graph.size(); ++u) {
+		edges += graph[u].size();
+		for (size_t i = 0; i < graph[u].size(); ++i)
+			weight += graph[u][i];
+	}
+	std::cout << graph.size() << " " << edges << " " << weight << std::endl;
+	std::cout << graph[0].size() << " " << graph[500].back() << std::endl;
+}
+
+void ft_iterator_kinds_test() {
+	std::cout << "\niterator_kinds\n" << std::endl;
+	std::list<std::string> list;
+	for (int i = 0; i < 6; ++i)
+		list.push_back(std::string(i + 1, 'a' + i));
+	std::vector<std::string> words(2, "x");
+
+	words.insert(words.begin() + 1, list.begin(), list.end());
+	words.insert(words.end(), list.rbegin(), list.rend());
+	std::istringstream in("in put it era tor");
+	words.insert(words.begin() + 3, std::istream_iterator<std::string>(in), std::istream_iterator<std::string>());
+	std::istringstream none("");
+	words.insert(words.begin(), std::istream_iterator<std::string>(none), std::istream_iterator<std::string>());
+	std::cout << "size    : " << words.size() << std::endl;
+	for (size_t i = 0; i < words.size(); ++i)
+		std::cout << words[i] << " ";
+	std::cout << std::endl;
+}
+
+int main(void) {
+	ft_modifiers_test();
+	ft_copy_move_test();
+	ft_strings_test();
+	ft_nested_test();
+	ft_iterator_kinds_test();
+	return 0;
+}
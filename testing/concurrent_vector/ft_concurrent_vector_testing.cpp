@@ -0,0 +1,155 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include "ft_concurrent_vector.hpp"
+#include "testing.hpp"
+
+// The ft side pushes from several threads at once; the std side pushes the
+// same values from one thread. Push order is not deterministic, so only
+// sorted contents are printed.
+
+static const int THREADS = 8;
+static const int PER_THREAD = 5000;
+
+template <class Vec>
+std::vector<int> sorted(Vec const & vec) {
+	std::vector<int> out;
+	for (size_t i = 0; i < vec.size(); ++i)
+		out.push_back(vec[i]);
+	std::sort(out.begin(), out.end());
+	return out;
+}
+
+void print(std::vector<int> const & values) {
+	long sum = 0;
+	for (size_t i = 0; i < values.size(); ++i)
+		sum += values[i];
+	std::cout << "size    : " << values.size() << std::endl;
+	std::cout << "sum     : " << sum << std::endl;
+	std::cout << "arr     :";
+	for (size_t i = 0; i < values.size() && i < 16; ++i)
+		std::cout << " " << values[i];
+	std::cout << " ... " << (values.empty() ? 0 : values.back()) << std::endl;
+}
+
+void ft_push_back_test() {
+	std::cout << "\npush_back\n" << std::endl;
+	ft::concurrent_vector<int> vec;
+	std::cout << vec.empty() << std::endl;
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < THREADS; ++t)
+		threads.push_back(std::thread([&vec, t] {
+			for (int i = 0; i < PER_THREAD; ++i)
+				vec.push_back(t * PER_THREAD + i);
+		}));
+	for (size_t t = 0; t < threads.size(); ++t)
+		threads[t].join();
+
+	bool all_ready = true;
+	for (size_t i = 0; i < vec.size(); ++i)
+		all_ready = all_ready && vec.ready(i);
+	std::cout << "ready   : " << all_ready << std::endl;
+	std::cout << "capacity covers size: " << (vec.capacity() >= vec.size()) << std::endl;
+	print(sorted(vec));
+	try {
+		vec.at(vec.size());
+	} catch (std::exception & e) {
+		std::cout << "out of range" << std::endl;
+	}
+}
+
+// Writers append while a reader keeps a reference to the first element and
+// scans whatever is already built; nothing it holds may move.
+void ft_stable_reference_test() {
+	std::cout << "\nstable_reference\n" << std::endl;
+	ft::concurrent_vector<int> vec;
+	vec.push_back(-1);
+	int & first = vec[0];
+	int * first_addr = &first;
+
+	std::atomic<bool> done(false);
+	std::atomic<bool> reader_ok(true);
+	std::thread reader([&] {
+		while (!done.load()) {
+			size_t n = vec.size();
+			for (size_t i = 0; i < n; ++i)
+				if (vec.ready(i) && (vec[i] < -1 || vec[i] >= THREADS * PER_THREAD))
+					reader_ok = false;
+			if (&vec[0] != first_addr || first != -1)
+				reader_ok = false;
+		}
+	});
+	std::vector<std::thread> writers;
+	for (int t = 0; t < THREADS; ++t)
+		writers.push_back(std::thread([&vec, t] {
+			for (int i = 0; i < PER_THREAD; ++i) {
+				size_t at = vec.push_back(t * PER_THREAD + i);
+				if (vec[at] != t * PER_THREAD + i)
+					std::abort();
+			}
+		}));
+	for (size_t t = 0; t < writers.size(); ++t)
+		writers[t].join();
+	done = true;
+	reader.join();
+
+	std::cout << "stable  : " << (&vec[0] == first_addr && first == -1) << std::endl;
+	std::cout << "reader  : " << reader_ok.load() << std::endl;
+	print(sorted(vec));
+}
+
+void ft_objects_test() {
+	std::cout << "\nobjects\n" << std::endl;
+	ft::concurrent_vector<std::string> strings;
+	ft::concurrent_vector<Test> tests;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t)
+		threads.push_back(std::thread([&strings, &tests, t] {
+			for (int i = 0; i < 1000; ++i) {
+				strings.emplace_back(20, static_cast<char>('a' + t));
+				tests.emplace_back(t * 1000 + i);
+			}
+		}));
+	for (size_t t = 0; t < threads.size(); ++t)
+		threads[t].join();
+
+	size_t counts[4] = {0, 0, 0, 0};
+	for (ft::concurrent_vector<std::string>::const_iterator it = strings.begin(); it != strings.end(); ++it)
+		counts[(*it)[0] - 'a'] += it->size() == 20;
+	std::cout << counts[0] << " " << counts[1] << " " << counts[2] << " " << counts[3] << std::endl;
+	std::vector<int> values;
+	for (size_t i = 0; i < tests.size(); ++i)
+		values.push_back(tests[i].some_);
+	std::sort(values.begin(), values.end());
+	print(values);
+}
+
+void ft_copy_clear_test() {
+	std::cout << "\ncopy_clear\n" << std::endl;
+	ft::concurrent_vector<int> vec;
+	for (int i = 0; i < 100; ++i)
+		vec.push_back(i * 3);
+	ft::concurrent_vector<int> copy(vec);
+	print(sorted(copy));
+	vec.clear();
+	std::cout << vec.size() << " " << vec.empty() << std::endl;
+	vec.push_back(7);
+	copy = vec;
+	print(sorted(copy));
+	vec.swap(copy);
+	print(sorted(vec));
+	vec.reserve(1000);
+	std::cout << "reserved: " << (vec.capacity() >= 1000) << std::endl;
+}
+
+int main(void) {
+	ft_push_back_test();
+	ft_stable_reference_test();
+	ft_objects_test();
+	ft_copy_clear_test();
+	return 0;
+}
@@ -0,0 +1,5 @@
+#! /bin/zsh
+mkdir logs
+
+clang++ -Wall -Wextra -Werror -pthread -I ../../impliment -I ../../utils -I ../../testing ft_concurrent_vector_testing.cpp -o logs/user_bin_for_leaks &&
+leaks -atExit -- logs/user_bin_for_leaks
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "testing.hpp"
+
+// Reference output: the same values pushed from a single thread.
+
+static const int THREADS = 8;
+static const int PER_THREAD = 5000;
+
+template <class Vec>
+std::vector<int> sorted(Vec const & vec) {
+	std::vector<int> out;
+	for (size_t i = 0; i < vec.size(); ++i)
+		out.push_back(vec[i]);
+	std::sort(out.begin(), out.end());
+	return out;
+}
+
+void print(std::vector<int> const & values) {
+	long sum = 0;
+	for (size_t i = 0; i < values.size(); ++i)
+		sum += values[i];
+	std::cout << "size    : " << values.size() << std::endl;
+	std::cout << "sum     : " << sum << std::endl;
+	std::cout << "arr     :";
+	for (size_t i = 0; i < values.size() && i < 16; ++i)
+		std::cout << " " << values[i];
+	std::cout << " ... " << (values.empty() ? 0 : values.back()) << std::endl;
+}
+
+void ft_push_back_test() {
+	std::cout << "\npush_back\n" << std::endl;
+	std::vector<int> vec;
+	std::cout << vec.empty() << std::endl;
+
+	for (int t = 0; t < THREADS; ++t)
+		for (int i = 0; i < PER_THREAD; ++i)
+			vec.push_back(t * PER_THREAD + i);
+
+	std::cout << "ready   : " << 1 << std::endl;
+	std::cout << "capacity covers size: " << (vec.capacity() >= vec.size()) << std::endl;
+	print(sorted(vec));
+	try {
+		vec.at(vec.size());
+	} catch (std::exception & e) {
+		std::cout << "out of range" << std::endl;
+	}
+}
+
+void ft_stable_reference_test() {
+	std::cout << "\nstable_reference\n" << std::endl;
+	std::vector<int> vec;
+	vec.reserve(THREADS * PER_THREAD + 1);
+	vec.push_back(-1);
+	int * first_addr = &vec[0];
+
+	for (int t = 0; t < THREADS; ++t)
+		for (int i = 0; i < PER_THREAD; ++i)
+			vec.push_back(t * PER_THREAD + i);
+
+	std::cout << "stable  : " << (&vec[0] == first_addr && vec[0] == -1) << std::endl;
+	std::cout << "reader  : " << 1 << std::endl;
+	print(sorted(vec));
+}
+
+void ft_objects_test() {
+	std::cout << "\nobjects\n" << std::endl;
+	std::vector<std::string> strings;
+	std::vector<Test> tests;
+	tests.reserve(4000);
+	for (int t = 0; t < 4; ++t)
+		for (int i = 0; i < 1000; ++i) {
+			strings.emplace_back(20, static_cast<char>('a' + t));
+			tests.emplace_back(t * 1000 + i);
+		}
+
+	size_t counts[4] = {0, 0, 0, 0};
+	for (std::vector<std::string>::const_iterator it = strings.begin(); it != strings.end(); ++it)
+		counts[(*it)[0] - 'a'] += it->size() == 20;
+	std::cout << counts[0] << " " << counts[1] << " " << counts[2] << " " << counts[3] << std::endl;
+	std::vector<int> values;
+	for (size_t i = 0; i < tests.size(); ++i)
+		values.push_back(tests[i].some_);
+	std::sort(values.begin(), values.end());
+	print(values);
+}
+
+void ft_copy_clear_test() {
+	std::cout << "\ncopy_clear\n" << std::endl;
+	std::vector<int> vec;
+	for (int i = 0; i < 100; ++i)
+		vec.push_back(i * 3);
+	std::vector<int> copy(vec);
+	print(sorted(copy));
+	vec.clear();
+	std::cout << vec.size() << " " << vec.empty() << std::endl;
+	vec.push_back(7);
+	copy = vec;
+	print(sorted(copy));
+	vec.swap(copy);
+	print(sorted(vec));
+	vec.reserve(1000);
+	std::cout << "reserved: " << (vec.capacity() >= 1000) << std::endl;
+}
+
+int main(void) {
+	ft_push_back_test();
+	ft_stable_reference_test();
+	ft_objects_test();
+	ft_copy_clear_test();
+	return 0;
+}
@@ -0,0 +1,175 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include "ft_deque.hpp"
+#include "testing.hpp"
+
+void print(const ft::deque<int> & deq) {
+	std::cout << "size    : " << deq.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < deq.size(); ++i) {
+		if (i != 0 && i % 32 == 0)
+			std::cout << std::endl;
+		std::cout << deq[i] << " ";
+	}
+	std::cout << std::endl;
+}
+
+void ft_both_ends_test() {
+	std::cout << "\nboth_ends\n" << std::endl;
+	ft::deque<int> deq;
+
+	std::cout << deq.empty() << std::endl;
+	for (int i = 0; i < 100; ++i)
+		deq.push_back(i);
+	for (int i = 1; i < 100; ++i)
+		deq.push_front(-i);
+	print(deq);
+	for (int i = 0; i < 30; ++i)
+		deq.pop_back();
+	for (int i = 0; i < 50; ++i)
+		deq.pop_front();
+	print(deq);
+	std::cout << deq.front() << " " << deq.back() << std::endl;
+	deq.front() = 1000;
+	deq.back() = 2000;
+	deq.emplace_front(3000);
+	deq.emplace_back(4000);
+	print(deq);
+	while (!deq.empty())
+		deq.pop_front();
+	print(deq);
+	deq.push_front(5);
+	deq.push_back(6);
+	print(deq);
+}
+
+void ft_no_relocation_test() {
+	std::cout << "\nno_relocation\n" << std::endl;
+	ft::deque<std::string> deq;
+
+	deq.push_back("first");
+	std::string * first = &deq.front();
+	for (int i = 0; i < 100000; ++i) {
+		deq.push_back(std::string(i % 20 + 1, 'a' + i % 26));
+		deq.push_front(std::string(i % 7 + 1, 'A' + i % 26));
+	}
+	std::cout << (first == &deq[100000]) << " " << *first << std::endl;
+	std::cout << deq.size() << " " << deq.front() << " " << deq.back() << std::endl;
+	size_t total = 0;
+	for (ft::deque<std::string>::iterator it = deq.begin(); it != deq.end(); ++it)
+		total += it->size();
+	std::cout << total << std::endl;
+}
+
+void ft_queue_test() {
+	std::cout << "\nqueue\n" << std::endl;
+	ft::deque<int> deq;
+	long sum = 0;
+
+	for (int i = 0; i < 10; ++i)
+		deq.push_back(i);
+	for (int i = 10; i < 300000; ++i) {
+		sum += deq.front();
+		deq.pop_front();
+		deq.push_back(i);
+	}
+	std::cout << sum << std::endl;
+	print(deq);
+}
+
+void ft_modifiers_test() {
+	std::cout << "\nmodifiers\n" << std::endl;
+	ft::deque<int> deq(10, 7);
+
+	print(deq);
+	deq.insert(deq.begin() + 2, 42);
+	deq.insert(deq.end() - 1, 43);
+	deq.insert(deq.begin() + 5, 3, 44);
+	print(deq);
+	int arr[] = {1, 2, 3, 4, 5};
+	deq.insert(deq.begin() + 1, arr, arr + 5);
+	deq.insert(deq.end(), arr, arr + 5);
+	print(deq);
+	ft::deque<int>::iterator it = deq.erase(deq.begin() + 2);
+	std::cout << *it << std::endl;
+	it = deq.erase(deq.begin() + 3, deq.begin() + 8);
+	std::cout << *it << std::endl;
+	it = deq.erase(deq.end() - 6, deq.end() - 2);
+	std::cout << *it << std::endl;
+	print(deq);
+	deq.resize(40, 9);
+	print(deq);
+	deq.resize(5);
+	print(deq);
+	deq.assign(arr, arr + 5);
+	print(deq);
+	deq.assign(600, 11);
+	print(deq);
+	deq.assign(3, 12);
+	print(deq);
+	try {
+		deq.at(3);
+	} catch (std::exception & e) {
+		std::cout << "out of range" << std::endl;
+	}
+	std::cout << deq.at(2) << std::endl;
+	deq.clear();
+	print(deq);
+}
+
+void ft_test_class_test() {
+	std::cout << "\ntest_class\n" << std::endl;
+	ft::deque<Test> deq;
+
+	for (int i = 0; i < 200; ++i) {
+		if (i % 2)
+			deq.push_back(i);
+		else
+			deq.push_front(i);
+	}
+	deq.insert(deq.begin() + 50, Test(-1));
+	deq.erase(deq.begin() + 120, deq.begin() + 180);
+	for (size_t i = 0; i < deq.size(); ++i)
+		std::cout << deq[i].some_ << " ";
+	std::cout << std::endl;
+}
+
+void ft_copy_compare_test() {
+	std::cout << "\ncopy_compare\n" << std::endl;
+	ft::deque<int> deq;
+
+	for (int i = 0; i < 1000; ++i)
+		deq.push_front(i);
+	ft::deque<int> copy(deq);
+	ft::deque<int> range(deq.begin() + 10, deq.begin() + 20);
+	print(range);
+	std::cout << (copy == deq) << (copy != deq) << (range < deq) << (range > deq) << std::endl;
+	copy.back() = -1;
+	std::cout << (copy == deq) << (copy < deq) << (copy >= deq) << std::endl;
+	ft::deque<int> moved(std::move(copy));
+	std::cout << moved.size() << " " << copy.size() << std::endl;
+	copy = range;
+	print(copy);
+	copy.swap(moved);
+	std::cout << moved.size() << " " << copy.size() << std::endl;
+	moved = std::move(copy);
+	std::cout << moved.size() << std::endl;
+
+	for (ft::deque<int>::reverse_iterator rit = range.rbegin(); rit != range.rend(); ++rit)
+		std::cout << *rit << " ";
+	std::cout << std::endl;
+	const ft::deque<int> & cref = range;
+	ft::deque<int>::const_iterator cit = cref.begin();
+	std::cout << *(cit + 3) << " " << cit[4] << " " << (cref.end() - cit) << std::endl;
+}
+
+int main(void) {
+	ft_both_ends_test();
+	ft_no_relocation_test();
+	ft_queue_test();
+	ft_modifiers_test();
+	ft_test_class_test();
+	ft_copy_compare_test();
+	return 0;
+}
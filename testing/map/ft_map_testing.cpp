@@ -1,13 +1,18 @@
 #include <iostream>
 #include <vector>
 #include <map>
+#include <thread>
 
 #include "ft_map.hpp"
+#include "arena_allocator.hpp"
+#include "pool_allocator.hpp"
+#include "memory_resource.hpp"
+#include "ft_vector.hpp"
 #include "testing.hpp"
 
 template <class KEY, class VAL>
-void print_map(ft::map<int, Test> & map) {
-	typename ft::map<int, Test>::iterator it(map.begin());
+void print_map(tested::map<int, Test> & map) {
+	typename tested::map<int, Test>::iterator it(map.begin());
 
 	std::cout
 			<< "empty: " << map.empty()
@@ -28,7 +33,7 @@ void print_map(ft::map<int, Test> & map) {
 
 void default_constructor() {
 	std::cout << "default_constructor" << std::endl;
-	ft::map<int, Test> def;
+	tested::map<int, Test> def;
 
 	print_map<int, Test>(def);
 }
@@ -42,7 +47,7 @@ void constructor_first_last() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
 	print_map<int, Test>(def);
 
@@ -57,8 +62,8 @@ void copy_constructor() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
-	ft::map<int, Test> copy_def(def);
+	tested::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> copy_def(def);
 
 	print_map<int, Test>(copy_def);
 }
@@ -72,7 +77,7 @@ void brackets() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
 	for (size_t i = 0; i < def.size(); ++i) {
 		std::cout << def[i].some_ << " ";
@@ -83,8 +88,8 @@ void brackets() {
 
 void insert_val() {
 	std::cout << "insert_val" << std::endl;
-	ft::map<int, Test>           def;
-	ft::map<int, Test>::iterator it;
+	tested::map<int, Test>           def;
+	tested::map<int, Test>::iterator it;
 
 	for (int i = 0; i < 20; ++i) {
 		if (i != 0 && i % 8 == 0) {
@@ -103,8 +108,8 @@ void insert_val() {
 
 void insert_position_val() {
 	std::cout << "insert_position_val" << std::endl;
-	ft::map<int, Test>           def;
-	ft::map<int, Test>::iterator it;
+	tested::map<int, Test>           def;
+	tested::map<int, Test>::iterator it;
 
 	for (int i = 0; i < 20; ++i) {
 		if (i != 0 && i % 8 == 0) {
@@ -132,7 +137,7 @@ void insert_first_last() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def;
+	tested::map<int, Test> def;
 
 	def.insert(src.begin(), src.end());
 	print_map<int, Test>(def);
@@ -147,11 +152,11 @@ void erase_position() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test>           def(src.begin(), src.end());
+	tested::map<int, Test>           def(src.begin(), src.end());
 
 	def.erase(def.begin());
 
-	ft::map<int, Test>::iterator it(def.begin());
+	tested::map<int, Test>::iterator it(def.begin());
 
 	++it; ++it; ++it;
 	def.erase(it);
@@ -170,7 +175,7 @@ void erase_key() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test>           def(src.begin(), src.end());
+	tested::map<int, Test>           def(src.begin(), src.end());
 
 	for (int i = 0; i < 20 ; i += 2) {
 		std::cout << def.erase(i) << std::endl;
@@ -189,9 +194,9 @@ void erase_firts_last() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test>           def(src.begin(), src.end());
-	ft::map<int, Test>::iterator first(def.begin());
-	ft::map<int, Test>::iterator last(def.end());
+	tested::map<int, Test>           def(src.begin(), src.end());
+	tested::map<int, Test>::iterator first(def.begin());
+	tested::map<int, Test>::iterator last(def.end());
 
 	++first; ++first; ++first; ++first;
 	--last; --last; --last; --last;
@@ -218,8 +223,8 @@ void swap() {
 		src2.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test>           def(src.begin(), src.end());
-	ft::map<int, Test>           def2(src2.begin(), src2.end());
+	tested::map<int, Test>           def(src.begin(), src.end());
+	tested::map<int, Test>           def2(src2.begin(), src2.end());
 
 	def.swap(def2);
 	print_map<int, Test>(def);
@@ -236,7 +241,7 @@ void clear() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
 	def.clear();
 	print_map<int, Test>(def);
@@ -252,7 +257,7 @@ void find() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
 	std::cout << (*def.find(0)).second.some_ << std::endl;
 	std::cout << (*def.find(15)).second.some_ << std::endl;
@@ -268,7 +273,7 @@ void count() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
 	std::cout << def.count(0) << std::endl;
 	std::cout << def.count(15) << std::endl;
@@ -283,7 +288,7 @@ void lower_bound() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
 	std::cout << (*def.lower_bound(0)).second.some_ << std::endl;
 	std::cout << (*def.lower_bound(15)).second.some_ << std::endl;
@@ -299,7 +304,7 @@ void upper_bound() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
 	std::cout << (*def.upper_bound(0)).second.some_ << std::endl;
 	std::cout << (*def.upper_bound(15)).second.some_ << std::endl;
@@ -314,9 +319,9 @@ void equal_range() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test> def(src.begin(), src.end());
+	tested::map<int, Test> def(src.begin(), src.end());
 
-	std::pair<ft::map<int, Test>::iterator, ft::map<int, Test>::iterator>
+	std::pair<tested::map<int, Test>::iterator, tested::map<int, Test>::iterator>
 	        pair1(def.equal_range(5));
 
 	while (pair1.first != pair1.second) {
@@ -324,7 +329,7 @@ void equal_range() {
 		++pair1.first;
 	}
 
-	std::pair<ft::map<int, Test>::iterator, ft::map<int, Test>::iterator>
+	std::pair<tested::map<int, Test>::iterator, tested::map<int, Test>::iterator>
 			pair2(def.equal_range(99));
 
 	while (pair2.first != pair2.second) {
@@ -341,8 +346,8 @@ void reverse_iterator() {
 		src.push_back(std::pair<int, Test>(i, i));
 	}
 
-	ft::map<int, Test>                   def(src.begin(), src.end());
-	ft::map<int, Test>::reverse_iterator rit(def.rbegin());
+	tested::map<int, Test>                   def(src.begin(), src.end());
+	tested::map<int, Test>::reverse_iterator rit(def.rbegin());
 
 	while (rit != def.rend()) {
 		std::cout << (*rit).second.some_ << " ";
@@ -351,35 +356,136 @@ void reverse_iterator() {
 	std::cout << std::endl;
 }
 
+// Maps whose nodes and values all come from one arena, freed in bulk after each round.
+void arena() {
+	std::cout << "arena" << std::endl;
+	typedef tested::map<int, Test, ft::less<int>, ft::arena_allocator<std::pair<const int, Test> > > arena_map;
+	ft::arena scratch(512);
+
+	for (int round = 0; round < 2; ++round) {
+		{
+			arena_map def(ft::less<int>(), scratch);
+			for (int i = 0; i < 50; ++i)
+				def.insert(std::pair<int, Test>((i * 7) % 50, i + round));
+			def.erase(3);
+			def.erase(def.find(10), def.find(20));
+			arena_map copy(def);
+			copy.insert(std::pair<int, Test>(100, 100));
+			arena_map other(ft::less<int>(), scratch);
+			other.insert(std::pair<int, Test>(-1, -1));
+			other.swap(copy);
+
+			for (int pass = 0; pass < 3; ++pass) {
+				arena_map & m = pass == 0 ? def : pass == 1 ? copy : other;
+				std::cout << "size: " << m.size() << "\n";
+				for (arena_map::iterator it = m.begin(); it != m.end(); ++it)
+					std::cout << (*it).first << ":" << (*it).second.some_ << " ";
+				std::cout << std::endl;
+			}
+		}
+		scratch.reset();
+	}
+}
+
+// Pool-allocated maps filled on four threads, then merged and destroyed on the
+// main thread, so most blocks are freed by a thread that did not allocate them.
+void pool() {
+	std::cout << "pool" << std::endl;
+	typedef tested::map<int, Test, ft::less<int>, ft::pool_allocator<std::pair<const int, Test> > > pool_map;
+	pool_map maps[4];
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t)
+		threads.push_back(std::thread([&maps, t] {
+			for (int i = 0; i < 300; ++i)
+				maps[t].insert(std::pair<int, Test>(i * 4 + t, i));
+			for (int i = 0; i < 300; i += 3)
+				maps[t].erase(i * 4 + t);
+		}));
+	for (size_t t = 0; t < threads.size(); ++t)
+		threads[t].join();
+	maps[0].swap(maps[1]);
+
+	pool_map merged;
+	for (int t = 0; t < 4; ++t) {
+		long sum = 0;
+		for (pool_map::iterator it = maps[t].begin(); it != maps[t].end(); ++it)
+			sum += (*it).first + (*it).second.some_;
+		std::cout << "size: " << maps[t].size() << " sum: " << sum << " first: " << (*maps[t].begin()).first << std::endl;
+		merged.insert(maps[t].begin(), maps[t].end());
+	}
+	merged.erase(merged.begin(), merged.find(604));
+	std::cout << "merged: " << merged.size() << " " << (*merged.begin()).first << std::endl;
+}
+
+// A map of vectors on polymorphic_allocator: the same type on two resources,
+// with every inner vector drawing from its map's resource.
+void polymorphic() {
+	std::cout << "polymorphic" << std::endl;
+	typedef tested::vector<int, ft::polymorphic_allocator<int> > ids;
+	typedef tested::map<int, ids, ft::less<int>, ft::polymorphic_allocator<std::pair<const int, ids> > > index_map;
+	ft::arena_resource scratch;
+	ft::pool_resource pool;
+	ft::memory_resource *resources[2] = {&scratch, &pool};
+
+	for (int r = 0; r < 2; ++r) {
+		index_map index(ft::less<int>(), resources[r]);
+		for (int i = 0; i < 40; ++i)
+			index[i % 7].push_back(i);
+		ids plain;
+		plain.push_back(-1);
+		index.insert(std::make_pair(100, plain));
+		index_map copy(index);
+		copy.erase(3);
+		index.swap(copy);
+
+		bool same = true;
+		for (index_map::iterator it = index.begin(); it != index.end(); ++it)
+			same = same && (*it).second.get_allocator().resource() == index.get_allocator().resource();
+		std::cout << "nested resource: " << same << std::endl;
+		for (index_map::iterator it = index.begin(); it != index.end(); ++it) {
+			std::cout << (*it).first << ":";
+			for (size_t i = 0; i < (*it).second.size(); ++i)
+				std::cout << " " << (*it).second[i];
+			std::cout << " | ";
+		}
+		std::cout << std::endl;
+	}
+}
+
 int main() {
 	// Constructors
-	default_constructor();
-	constructor_first_last();
-	copy_constructor();
+	ALLOC_COUNTS(default_constructor());
+	ALLOC_COUNTS(constructor_first_last());
+	ALLOC_COUNTS(copy_constructor());
 	// ------------
 
 	// Element access
-	brackets();
+	ALLOC_COUNTS(brackets());
 	// ------------
 
 	//Modifiers
-	insert_val();
-	insert_position_val();
-	insert_first_last();
-	erase_position();
-	erase_key();
-	erase_firts_last();
-	swap();
-	clear();
+	ALLOC_COUNTS(insert_val());
+	ALLOC_COUNTS(insert_position_val());
+	ALLOC_COUNTS(insert_first_last());
+	ALLOC_COUNTS(erase_position());
+	ALLOC_COUNTS(erase_key());
+	ALLOC_COUNTS(erase_firts_last());
+	ALLOC_COUNTS(swap());
+	ALLOC_COUNTS(clear());
+	ALLOC_COUNTS(arena());
+	ALLOC_COUNTS(pool());
+	ALLOC_COUNTS(polymorphic());
 	// ------------
 
 	// Operations
-	find();
-	count();
-	lower_bound();
-	upper_bound();
-	equal_range();
+	ALLOC_COUNTS(find());
+	ALLOC_COUNTS(count());
+	ALLOC_COUNTS(lower_bound());
+	ALLOC_COUNTS(upper_bound());
+	ALLOC_COUNTS(equal_range());
 	// ------------
-	reverse_iterator();
+	ALLOC_COUNTS(reverse_iterator());
+	ALLOC_SUMMARY();
 	return 0;
 }
@@ -351,6 +351,89 @@ void reverse_iterator() {
 	std::cout << std::endl;
 }
 
+// Reference for the arena-backed ft::map.
+void arena() {
+	std::cout << "arena" << std::endl;
+	typedef std::map<int, Test> arena_map;
+
+	for (int round = 0; round < 2; ++round) {
+		{
+			arena_map def;
+			for (int i = 0; i < 50; ++i)
+				def.insert(std::pair<int, Test>((i * 7) % 50, i + round));
+			def.erase(3);
+			def.erase(def.find(10), def.find(20));
+			arena_map copy(def);
+			copy.insert(std::pair<int, Test>(100, 100));
+			arena_map other;
+			other.insert(std::pair<int, Test>(-1, -1));
+			other.swap(copy);
+
+			for (int pass = 0; pass < 3; ++pass) {
+				arena_map & m = pass == 0 ? def : pass == 1 ? copy : other;
+				std::cout << "size: " << m.size() << "\n";
+				for (arena_map::iterator it = m.begin(); it != m.end(); ++it)
+					std::cout << (*it).first << ":" << (*it).second.some_ << " ";
+				std::cout << std::endl;
+			}
+		}
+	}
+}
+
+// Reference for the pool-allocated ft::map, filled on one thread.
+void pool() {
+	std::cout << "pool" << std::endl;
+	typedef std::map<int, Test> pool_map;
+	pool_map maps[4];
+
+	for (int t = 0; t < 4; ++t) {
+		for (int i = 0; i < 300; ++i)
+			maps[t].insert(std::pair<int, Test>(i * 4 + t, i));
+		for (int i = 0; i < 300; i += 3)
+			maps[t].erase(i * 4 + t);
+	}
+	maps[0].swap(maps[1]);
+
+	pool_map merged;
+	for (int t = 0; t < 4; ++t) {
+		long sum = 0;
+		for (pool_map::iterator it = maps[t].begin(); it != maps[t].end(); ++it)
+			sum += (*it).first + (*it).second.some_;
+		std::cout << "size: " << maps[t].size() << " sum: " << sum << " first: " << (*maps[t].begin()).first << std::endl;
+		merged.insert(maps[t].begin(), maps[t].end());
+	}
+	merged.erase(merged.begin(), merged.find(604));
+	std::cout << "merged: " << merged.size() << " " << (*merged.begin()).first << std::endl;
+}
+
+// Reference for the ft::map of vectors on polymorphic_allocator.
+void polymorphic() {
+	std::cout << "polymorphic" << std::endl;
+	typedef std::vector<int> ids;
+	typedef std::map<int, ids> index_map;
+
+	for (int r = 0; r < 2; ++r) {
+		index_map index;
+		for (int i = 0; i < 40; ++i)
+			index[i % 7].push_back(i);
+		ids plain;
+		plain.push_back(-1);
+		index.insert(std::make_pair(100, plain));
+		index_map copy(index);
+		copy.erase(3);
+		index.swap(copy);
+
+		std::cout << "nested resource: " << 1 << std::endl;
+		for (index_map::iterator it = index.begin(); it != index.end(); ++it) {
+			std::cout << (*it).first << ":";
+			for (size_t i = 0; i < (*it).second.size(); ++i)
+				std::cout << " " << (*it).second[i];
+			std::cout << " | ";
+		}
+		std::cout << std::endl;
+	}
+}
+
 int main() {
 	// Constructors
 	default_constructor();
@@ -371,6 +454,9 @@ int main() {
 	erase_firts_last();
 	swap();
 	clear();
+	arena();
+	pool();
+	polymorphic();
 	// ------------
 
 	// Operations
@@ -0,0 +1,131 @@
+#include <iostream>
+#include <string>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <vector>
+#include "testing.hpp"
+
+// small_vector must behave like a vector; its capacity differs by design, so it is not printed.
+
+void print(const std::vector<Test> & vec) {
+	std::cout << "size    : " << vec.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < vec.size(); ++i) {
+		if (i != 0 && i % 32 == 0)
+			std::cout << std::endl;
+		std::cout << vec[i].some_ << " ";
+	}
+	std::cout << std::endl;
+}
+
+void ft_inline_to_heap_test() {
+	std::cout << "\ninline_to_heap\n" << std::endl;
+	std::vector<Test> vec;
+
+	for (int i = 0; i < 8; ++i)
+		vec.push_back(i);
+	print(vec);
+	vec.push_back(8);
+	vec.emplace_back(9);
+	print(vec);
+	vec.insert(vec.begin() + 3, 5, 42);
+	print(vec);
+	vec.erase(vec.begin(), vec.begin() + 10);
+	print(vec);
+	vec.resize(20, 7);
+	print(vec);
+	vec.resize(2);
+	print(vec);
+}
+
+void ft_copy_move_test() {
+	std::cout << "\ncopy_move\n" << std::endl;
+	std::vector<Test> small(4, 1);
+	std::vector<Test> big(40, 2);
+
+	std::vector<Test> small_copy(small);
+	std::vector<Test> big_copy(big);
+	print(small_copy);
+	print(big_copy);
+
+	std::vector<Test> small_moved(std::move(small_copy));
+	std::vector<Test> big_moved(std::move(big_copy));
+	print(small_moved);
+	print(big_moved);
+
+	small_moved = big;
+	big_moved = small;
+	print(small_moved);
+	print(big_moved);
+
+	small_moved.swap(big_moved);
+	print(small_moved);
+	print(big_moved);
+
+	small_moved.assign(big.begin() + 5, big.end() - 30);
+	print(small_moved);
+
+	std::vector<int> lhs(3, 1);
+	std::vector<int> rhs(12, 1);
+	std::cout << (lhs == rhs) << (lhs < rhs) << (rhs <= lhs) << (lhs != rhs) << std::endl;
+}
+
+void ft_strings_test() {
+	std::cout << "\nstrings\n" << std::endl;
+	std::vector<std::string> words;
+
+	for (size_t i = 0; i < 30; ++i)
+		words.push_back(std::string(i % 12 + 1, 'a' + i % 26));
+	words.insert(words.begin() + 2, words[10]);
+	words.erase(words.begin() + 5);
+	for (size_t i = 0; i < words.size(); ++i)
+		std::cout << words[i] << " ";
+	std::cout << std::endl;
+}
+
+void print_words(const std::vector<std::string> & words) {
+	std::cout << "size    : " << words.size() << std::endl;
+	for (size_t i = 0; i < words.size(); ++i)
+		std::cout << words[i] << " ";
+	std::cout << std::endl;
+}
+
+void ft_iterator_kinds_test() {
+	std::cout << "\niterator_kinds\n" << std::endl;
+	std::list<std::string> list;
+	for (int i = 0; i < 12; ++i)
+		list.push_back(std::string(i + 1, 'a' + i));
+	std::vector<std::string> vec(3, "x");
+
+	vec.insert(vec.begin() + 1, list.begin(), list.end());
+	print_words(vec);
+	std::istringstream in("in put it era tor");
+	vec.insert(vec.begin() + 2, std::istream_iterator<std::string>(in), std::istream_iterator<std::string>());
+	print_words(vec);
+
+	vec.assign(list.begin(), list.end());
+	print_words(vec);
+	std::cout << "reused  : " << 1 << std::endl;
+	std::istringstream more("one two three");
+	vec.assign(std::istream_iterator<std::string>(more), std::istream_iterator<std::string>());
+	print_words(vec);
+	vec.assign(5, "y");
+	print_words(vec);
+	std::cout << "reused  : " << 1 << std::endl;
+
+	std::vector<std::string> small(2, "z");
+	small.assign(6, "w");
+	print_words(small);
+	small.assign(std::next(list.begin(), 5), list.end());
+	print_words(small);
+	std::cout << "inline  : " << 1 << std::endl;
+}
+
+int main(void) {
+	ft_inline_to_heap_test();
+	ft_copy_move_test();
+	ft_strings_test();
+	ft_iterator_kinds_test();
+	return 0;
+}
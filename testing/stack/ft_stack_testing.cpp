@@ -1,9 +1,10 @@
 #include <iostream>
 
 #include "ft_stack.hpp"
+#include "testing.hpp"
 
 void ft_stack_testing() {
-	ft::stack<int> cont;
+	tested::stack<int> cont;
 
 	std::cout << cont.empty() << std::endl;
 	std::cout << cont.size() << std::endl;
@@ -24,7 +25,8 @@ void ft_stack_testing() {
 }
 
 int main(void) {
-	ft_stack_testing();
+	ALLOC_COUNTS(ft_stack_testing());
+	ALLOC_SUMMARY();
 
 	return 0;
 }
@@ -7,6 +7,9 @@ mkdir logs
 
 	clang++ -Wall -Wextra -Werror -I ../../impliment -I ../../utils -I ../ -fsanitize=address ./ft_stack_testing.cpp -o logs/user_bin &&
 	./logs/user_bin > logs/user.output &&
+	clang++ -Wall -Wextra -Werror -DFT_ALLOC_STATS -I ../../impliment -I ../../utils -I ../ -fsanitize=address ./ft_stack_testing.cpp -o logs/user_stats_bin &&
+	./logs/user_stats_bin > logs/user_stats.output 2> logs/user.allocs &&
 	clang++ -Wall -Wextra -Werror -I -fsanitize=address std_stack_testing.cpp -o logs/bin &&
 	./logs/bin > logs/std.output &&
-	diff logs/user.output logs/std.output
\ No newline at end of file
+	diff logs/user.output logs/std.output &&
+	diff logs/user_stats.output logs/std.output
\ No newline at end of file
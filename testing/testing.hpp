@@ -20,6 +20,7 @@ class Test {
 		Test &operator=(Test const & x) {
 			if (this == &x)
 				return (*this);
+			free(this->str_);
 			this->str_ = (char*)malloc(10);
 			this->some_ = x.some_;
 			return (*this);
@@ -34,4 +35,25 @@ class Test {
 };
 /* -------------------------------------------------------------------------- */
 
+/* --------------------------- Allocation counting -------------------------- */
+// The ft tests name their containers tested::vector, tested::map, ... A plain
+// build tests the ft containers with their std::allocator defaults. test.sh
+// also builds them with -DFT_ALLOC_STATS: tested is then ft::stats, whose
+// aliases default to a stats_allocator (see ft_stats_containers.hpp).
+// ALLOC_COUNTS(test()) runs a test and prints, on stderr, what each container
+// type allocated during it; ALLOC_SUMMARY() prints the totals with their size
+// histograms. Without FT_ALLOC_STATS they only run the test.
+#ifdef FT_ALLOC_STATS
+# include "ft_stats_containers.hpp"
+namespace tested = ft::stats;
+# define ALLOC_COUNTS(test) do { ft::alloc_stats_scope alloc_scope_(#test); test; } while (0)
+# define ALLOC_SUMMARY() ft::print_alloc_stats(std::cerr)
+#else
+namespace ft {}
+namespace tested = ft;
+# define ALLOC_COUNTS(test) test
+# define ALLOC_SUMMARY() ((void)0)
+#endif
+/* -------------------------------------------------------------------------- */
+
 #endif
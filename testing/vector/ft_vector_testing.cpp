@@ -1,6 +1,19 @@
 #include <vector>
+#include <unistd.h>
 #include "ft_vector.hpp"
+#include "read_into.hpp"
+#include "arena_allocator.hpp"
+#include "memory_resource.hpp"
+#include "aligned_allocator.hpp"
+#include "hugepage_allocator.hpp"
+#include "stats_allocator.hpp"
 #include <iostream>
+#include <string>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <atomic>
+#include <stdexcept>
 #include <vector>
 
 #include "testing.hpp"
@@ -9,7 +22,7 @@
 
 void ft_defoult_constructor() {
 	std::cout << "\ndefoult_constructor\n" << std::endl;
-	ft::vector<Test> useless;
+	tested::vector<Test> useless;
 
 	std::cout << "empty() : " << useless.empty()    << std::endl;
 	std::cout << "size    : " << useless.size()     << std::endl;
@@ -25,7 +38,7 @@ void ft_defoult_constructor() {
 
 void ft_n_constructor() {
 	std::cout << "\nn_constructor\n" << std::endl;
-	ft::vector<Test> useless(20);
+	tested::vector<Test> useless(20);
 	for (size_t i = 0; i < useless.size(); ++i) {
 		useless[i].some_ = i;
 	}
@@ -44,7 +57,7 @@ void ft_n_constructor() {
 
 void ft_n_val_constructor() {
 	std::cout << "\nn_val_constructor\n" << std::endl;
-	ft::vector<Test> useless(128, 2);
+	tested::vector<Test> useless(128, 2);
 
 	std::cout << "size    : " << useless.size()     << std::endl;
 	std::cout << "capacity: " << useless.capacity() << std::endl;
@@ -60,11 +73,11 @@ void ft_n_val_constructor() {
 
 void ft_copy_constructor() {
 	std::cout << "\ncopy_constructor\n" << std::endl;
-	ft::vector<Test> base(128);
+	tested::vector<Test> base(128);
 	for (size_t i = 0; i < base.size(); ++i) {
 		base[i].some_ = i;
 	}
-	ft::vector<Test> copy(base);
+	tested::vector<Test> copy(base);
 
 	std::cout << "size    : " << copy.size()     << std::endl;
 	std::cout << "capacity: " << copy.capacity() << std::endl;
@@ -80,13 +93,13 @@ void ft_copy_constructor() {
 
 void ft_resize_test() {
 	std::cout << "\nresize_test\n" << std::endl;
-	ft::vector<Test> mouse(128);
+	tested::vector<Test> mouse(128);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> big_empty(mouse);
-	ft::vector<Test> small_mouse(mouse);
-	ft::vector<Test> big_mouse(mouse);
+	tested::vector<Test> big_empty(mouse);
+	tested::vector<Test> small_mouse(mouse);
+	tested::vector<Test> big_mouse(mouse);
 
 	std::cout << "size    : " << mouse.size()     << std::endl;
 	std::cout << "capacity: " << mouse.capacity() << std::endl;
@@ -177,8 +190,8 @@ void ft_resize_test() {
 
 void ft_reserve_test() {
 	std::cout << "\nreserve_test\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> empty;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> empty;
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
@@ -307,12 +320,12 @@ void ft_constructors_capacity_test() {
 
 void ft_operator_assignment() {
 	std::cout << "\noperator_assignment\n" << std::endl;
-	ft::vector<Test> base(128);
+	tested::vector<Test> base(128);
 	for (size_t i = 0; i < base.size(); ++i) {
 		base[i].some_ = i;
 	}
 
-	ft::vector<Test> copy;
+	tested::vector<Test> copy;
 	copy = base;
 
 	std::cout << "size    : " << copy.size()     << std::endl;
@@ -333,7 +346,7 @@ void ft_operator_assignment() {
 
 void ft_iterator_test() {
 	std::cout << "\niterator_test\n" << std::endl;
-	ft::vector<Test> mouse(128);
+	tested::vector<Test> mouse(128);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
@@ -359,8 +372,8 @@ void ft_iterator_test() {
 
 void ft_el_access_test() {
 	std::cout << "\nel_access_test\n" << std::endl;
-	ft::vector<Test> one(1, 2);
-	ft::vector<Test> mouse(128);
+	tested::vector<Test> one(1, 2);
+	tested::vector<Test> mouse(128);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
@@ -395,19 +408,19 @@ void ft_el_access_test() {
 
 void ft_assign_iter_iter_leaks_test() {
 	std::cout << "\nassign_iter_iter\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> empty;
-	ft::vector<Test> empty2;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> empty;
+	tested::vector<Test> empty2;
 	empty2.reserve(1023);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> fat_mouse(344);
+	tested::vector<Test> fat_mouse(344);
 	for (size_t i = 0; i < fat_mouse.size(); ++i) {
 		fat_mouse[i].some_ = i + 1000;
 	}
 
-	ft::vector<Test> small_mouse(5);
+	tested::vector<Test> small_mouse(5);
 	for (size_t i = 0; i < small_mouse.size(); ++i) {
 		small_mouse[i].some_ = i + 500;
 	}
@@ -461,11 +474,11 @@ void ft_assign_iter_iter_leaks_test() {
 
 void ft_assign_iter_iter_1280b_leaks_test() {
 	std::cout << "\nassign_iter_iter_1280_leaks\n" << std::endl;
-	ft::vector<Test> mouse(128);
+	tested::vector<Test> mouse(128);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> fat_mouse(344);
+	tested::vector<Test> fat_mouse(344);
 	for (size_t i = 0; i < fat_mouse.size(); ++i) {
 		fat_mouse[i].some_ = i + 1000;
 	}
@@ -564,9 +577,9 @@ void ft_assign_iter_iter_1280b_leaks_test() {
 
 void ft_assign_n_val_test() {
 	std::cout << "\nassign_n_val\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> empty;
-	ft::vector<Test> empty2;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> empty;
+	tested::vector<Test> empty2;
 	empty2.reserve(1023);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
@@ -622,9 +635,9 @@ void ft_assign_n_val_test() {
 
 void ft_push_back_test() {
 	std::cout << "\npush_back\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> empty;
-	ft::vector<Test> empty2;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> empty;
+	tested::vector<Test> empty2;
 	empty2.reserve(1023);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
@@ -670,9 +683,9 @@ void ft_push_back_test() {
 
 void ft_pop_back_test() {
 	std::cout << "\npop_back\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> empty;
-	ft::vector<Test> empty2;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> empty;
+	tested::vector<Test> empty2;
 	empty2.reserve(1023);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
@@ -695,12 +708,12 @@ void ft_pop_back_test() {
 
 void ft_insert_iter_val_test() {
 	std::cout << "\ninsert_iter_val\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> fat_mouse(1023);
-	ft::vector<Test> small_mouse(11);
-	ft::vector<Test> empty;
-	ft::vector<Test> empty2;
-	ft::vector<Test> big_empty;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> fat_mouse(1023);
+	tested::vector<Test> small_mouse(11);
+	tested::vector<Test> empty;
+	tested::vector<Test> empty2;
+	tested::vector<Test> big_empty;
 	big_empty.reserve(2023);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
@@ -757,12 +770,12 @@ void ft_insert_iter_val_test() {
 }
 void ft_insert_iter_n_val_test() {
 	std::cout << "\ninsert_iter_n_val\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> fat_mouse(1023);
-	ft::vector<Test> small_mouse(11);
-	ft::vector<Test> empty;
-	ft::vector<Test> empty2;
-	ft::vector<Test> big_empty;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> fat_mouse(1023);
+	tested::vector<Test> small_mouse(11);
+	tested::vector<Test> empty;
+	tested::vector<Test> empty2;
+	tested::vector<Test> big_empty;
 	big_empty.reserve(2023);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
@@ -832,19 +845,19 @@ void ft_insert_iter_n_val_test() {
 
 void ft_insert_iter_iter_iter_test() {
 	std::cout << "\niter_iter_iter\n" << std::endl;
-	ft::vector<Test> mouse(128);
-	ft::vector<Test> empty;
-	ft::vector<Test> empty2;
+	tested::vector<Test> mouse(128);
+	tested::vector<Test> empty;
+	tested::vector<Test> empty2;
 	empty2.reserve(1023);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> fat_mouse(344);
+	tested::vector<Test> fat_mouse(344);
 	for (size_t i = 0; i < fat_mouse.size(); ++i) {
 		fat_mouse[i].some_ = i + 1000;
 	}
 
-	ft::vector<Test> small_mouse(5);
+	tested::vector<Test> small_mouse(5);
 	for (size_t i = 0; i < small_mouse.size(); ++i) {
 		small_mouse[i].some_ = i + 500;
 	}
@@ -898,11 +911,11 @@ void ft_insert_iter_iter_iter_test() {
 
 void ft_insert_iter_iter_iter_8390_leaks_test() {
 	std::cout << "\nassign_iter_iter_1280_leaks\n" << std::endl;
-	ft::vector<Test> mouse(128);
+	tested::vector<Test> mouse(128);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> fat_mouse(344);
+	tested::vector<Test> fat_mouse(344);
 	for (size_t i = 0; i < fat_mouse.size(); ++i) {
 		fat_mouse[i].some_ = i + 1000;
 	}
@@ -1001,11 +1014,11 @@ void ft_insert_iter_iter_iter_8390_leaks_test() {
 
 void ft_erase_2540_leaks_test() {
 	std::cout << "erase_2540_leaks_test" << std::endl;
-	ft::vector<Test> mouse(129);
+	tested::vector<Test> mouse(129);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> big_mouse(1023);
+	tested::vector<Test> big_mouse(1023);
 	for (size_t i = 0; i < big_mouse.size(); ++i) {
 		big_mouse[i].some_ = i + 1000;
 	}
@@ -1070,13 +1083,543 @@ void ft_erase_2540_leaks_test() {
 	std::cout << std::endl;
 }
 
+bool is_odd_some(Test const & x) { return x.some_ % 2 != 0; }
+
+bool is_big_some(Test const & x) { return x.some_ >= 1000; }
+
+void ft_erase_if_test() {
+	std::cout << "erase_if_test" << std::endl;
+	tested::vector<Test> mouse(129);
+	for (size_t i = 0; i < mouse.size(); ++i) {
+		mouse[i].some_ = i;
+	}
+	tested::vector<Test> empty;
+
+	std::cout << ft::erase_if(mouse, is_odd_some) << std::endl;
+
+	std::cout << "size    : " << mouse.size()     << std::endl;
+	std::cout << "capacity: " << mouse.capacity() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < mouse.size(); ++i) {
+		if (i != 0 && i % 32 == 0)
+			std::cout << std::endl;
+		std::cout << mouse.at(i).some_ << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << ft::erase_if(mouse, is_big_some) << std::endl;
+	std::cout << ft::erase_if(empty, is_odd_some) << std::endl;
+
+	std::cout << "size    : " << empty.size()     << std::endl;
+	std::cout << "capacity: " << empty.capacity() << std::endl;
+}
+
+void ft_relocation_test() {
+	std::cout << "relocation_test" << std::endl;
+	tested::vector<std::string> words;
+
+	// short strings keep their characters inside the object itself
+	for (size_t i = 0; i < 100; ++i)
+		words.push_back(std::string(i % 12 + 1, 'a' + i % 26));
+	words.insert(words.begin() + 10, 40, "mid");
+	words.erase(words.begin(), words.begin() + 25);
+	words.reserve(1000);
+
+	std::cout << "size    : " << words.size()     << std::endl;
+	std::cout << "capacity: " << words.capacity() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < words.size(); ++i) {
+		if (i != 0 && i % 16 == 0)
+			std::cout << std::endl;
+		std::cout << words[i] << " ";
+	}
+	std::cout << std::endl;
+}
+
+void ft_move_emplace_test() {
+	std::cout << "move_emplace_test" << std::endl;
+	tested::vector<std::string> words;
+	std::string heavy(100, 'h');
+
+	words.push_back(std::move(heavy));
+	words.emplace_back(5, 'e');
+	words.emplace_back("literal");
+	words.emplace(words.begin() + 1, 3, 'm');
+	words.emplace(words.begin(), words[2]);
+	words.insert(words.end(), std::string("tail"));
+	std::cout << "moved from: " << heavy.size() << std::endl;
+
+	tested::vector<std::string> stolen(std::move(words));
+	std::cout << "size    : " << words.size()     << std::endl;
+	std::cout << "capacity: " << words.capacity() << std::endl;
+	std::cout << "size    : " << stolen.size()    << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < stolen.size(); ++i)
+		std::cout << stolen[i] << " ";
+	std::cout << std::endl;
+
+	tested::vector<std::string> target(10, "old");
+	target = std::move(stolen);
+	std::cout << "size    : " << stolen.size()    << std::endl;
+	std::cout << "size    : " << target.size()    << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < target.size(); ++i)
+		std::cout << target[i] << " ";
+	std::cout << std::endl;
+
+	tested::vector<tested::vector<Test> > nested;
+	for (int i = 0; i < 40; ++i) {
+		nested.push_back(tested::vector<Test>(i, i));
+		nested.back().emplace_back(i * 2);
+	}
+	std::cout << "size    : " << nested.size()    << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < nested.size(); ++i)
+		std::cout << nested[i].size() << ":" << nested[i].back().some_ << " ";
+	std::cout << std::endl;
+}
+
+void ft_resize_default_init_test() {
+	std::cout << "resize_default_init_test" << std::endl;
+	tested::vector<int> ints(5, 42);
+	ints.resize_default_init(300);
+	for (size_t i = 5; i < ints.size(); ++i)
+		ints[i] = i;
+	ints.resize_default_init(100);
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+
+	int fds[2];
+	if (pipe(fds) != 0)
+		return;
+	if (write(fds[1], "receive buffer", 14) != 14)
+		return;
+	close(fds[1]);
+	tested::vector<char> buf(3, '>');
+	ssize_t got;
+	while ((got = ft::read_into(fds[0], buf, 4)) > 0)
+		std::cout << got << " ";
+	close(fds[0]);
+	std::cout << got << std::endl;
+	std::cout << "size    : " << buf.size() << std::endl;
+	for (size_t i = 0; i < buf.size(); ++i)
+		std::cout << buf[i];
+	std::cout << std::endl;
+}
+
+void ft_range_category_test() {
+	std::cout << "range_category_test" << std::endl;
+	std::istringstream numbers("1 2 3 4 5 6 7 8 9 10");
+	tested::vector<int> ints((std::istream_iterator<int>(numbers)), std::istream_iterator<int>());
+	std::list<std::string> words;
+	for (int i = 0; i < 40; ++i)
+		words.push_back(std::string(i % 7, 'a' + i % 26));
+	tested::vector<std::string> strings(words.begin(), words.end());
+	std::cout << "size    : " << strings.size()     << std::endl;
+	std::cout << "capacity: " << strings.capacity() << std::endl;
+
+	strings.insert(strings.begin() + 3, words.begin(), words.end());
+	std::istringstream more("11 12 13");
+	ints.insert(ints.begin() + 2, std::istream_iterator<int>(more), std::istream_iterator<int>());
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+
+	int raw[] = {42, 43, 44, 45};
+	ints.assign(raw, raw + 4);
+	ints.insert(ints.begin() + 1, raw, raw + 4);
+	strings.assign(words.begin(), words.end());
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+	std::istringstream last("7 8");
+	ints.assign(std::istream_iterator<int>(last), std::istream_iterator<int>());
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+	std::cout << "size    : " << strings.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < strings.size(); ++i)
+		std::cout << strings[i] << " ";
+	std::cout << std::endl;
+}
+
+void ft_shrink_to_fit_test() {
+	std::cout << "shrink_to_fit_test" << std::endl;
+	tested::vector<int> ints(1000, 3);
+	ints.erase(ints.begin() + 10, ints.end());
+	std::cout << "payload : " << ints.memory_usage().payload << std::endl;
+	std::cout << "slack   : " << ints.memory_usage().slack << std::endl;
+	ints.shrink_to_fit();
+	std::cout << "size    : " << ints.size()     << std::endl;
+	std::cout << "capacity: " << ints.capacity() << std::endl;
+	std::cout << "payload : " << ints.memory_usage().payload << std::endl;
+	std::cout << "slack   : " << ints.memory_usage().slack << std::endl;
+
+	tested::vector<std::string> strings(100, "shrink");
+	strings.resize(5);
+	strings.shrink_to_fit();
+	strings.push_back("grown");
+	std::cout << "size    : " << strings.size()     << std::endl;
+	std::cout << "capacity: " << strings.capacity() << std::endl;
+	for (size_t i = 0; i < strings.size(); ++i)
+		std::cout << strings[i] << " ";
+	std::cout << std::endl;
+	strings.clear();
+	strings.shrink_to_fit();
+	std::cout << "capacity: " << strings.capacity() << std::endl;
+}
+
+void ft_bool_test() {
+	std::cout << "bool_test" << std::endl;
+	tested::vector<bool> bits;
+	for (int i = 0; i < 300; ++i)
+		bits.push_back(i % 3 == 0 || i % 7 == 0);
+	bits.insert(bits.begin() + 70, 90, true);
+	bits.erase(bits.begin() + 5, bits.begin() + 133);
+	bits[0].flip();
+	bits.back() = true;
+	bits.resize(200);
+	std::cout << "size    : " << bits.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < bits.size(); ++i)
+		std::cout << bits[i];
+	std::cout << std::endl;
+	std::cout << "count   : " << bits.count() << std::endl;
+	std::cout << "first   : " << bits.find_first() << std::endl;
+	bits.flip();
+	std::cout << "count   : " << bits.count() << std::endl;
+	std::cout << "first   : " << bits.find_first() << std::endl;
+
+	tested::vector<bool> mask(150, true);
+	mask[3] = false;
+	bits &= mask;
+	std::cout << "count   : " << bits.count() << std::endl;
+	for (tested::vector<bool>::reverse_iterator it = bits.rbegin(); it != bits.rend(); ++it)
+		std::cout << *it;
+	std::cout << std::endl;
+
+	tested::vector<bool> copy(bits);
+	std::cout << (copy == bits) << (copy < bits) << std::endl;
+	copy[199] = true;
+	std::cout << (copy == bits) << (copy < bits) << (bits < copy) << std::endl;
+	copy.resize(100);
+	std::cout << (copy == bits) << (copy < bits) << (bits < copy) << std::endl;
+}
+
+// Insert and erase shift the tail a word at a time; every offset and length
+// modulo 64 goes through the funnel shift.
+void ft_bool_shift_test() {
+	std::cout << "bool_shift_test" << std::endl;
+	size_t sizes[] = {1, 63, 64, 65, 127, 128, 200, 3};
+	tested::vector<bool> pattern;
+	for (int i = 0; i < 64; ++i)
+		pattern.push_back(i % 5 == 0);
+	tested::vector<bool> bits;
+	for (int i = 0; i < 1000; ++i)
+		bits.push_back(i % 3 == 0 || i % 7 == 0);
+
+	for (int round = 0; round < 12; ++round) {
+		size_t at = (round * 37) % (bits.size() / 2);
+		size_t n = sizes[round % 8];
+		bits.insert(bits.begin() + at, n, round % 2 == 0);
+		bits.erase(bits.begin() + (at * 3) % bits.size() / 2, bits.begin() + (at * 3) % bits.size() / 2 + sizes[(round + 3) % 8]);
+		bits.insert(bits.begin() + at / 2, pattern.begin(), pattern.begin() + n % 50);
+	}
+	bits.erase(bits.begin(), bits.begin() + 64);
+	bits.erase(bits.begin() + 1, bits.begin() + 2);
+	bits.insert(bits.begin(), 128, true);
+	bits.erase(bits.end() - 65, bits.end());
+	std::cout << "size    : " << bits.size() << std::endl;
+	for (size_t i = 0; i < bits.size(); ++i) {
+		if (i != 0 && i % 128 == 0)
+			std::cout << std::endl;
+		std::cout << bits[i];
+	}
+	std::cout << std::endl;
+	std::cout << "count   : " << bits.count() << std::endl;
+
+	ft::arena scratch;
+	tested::vector<bool, ft::arena_allocator<bool> > flags(scratch);
+	flags.assign(pattern.begin(), pattern.end());
+	flags.insert(flags.begin() + 3, pattern.begin(), pattern.end());
+	std::cout << flags.size() << " " << flags.count() << " " << (flags.get_allocator().resource() == &scratch) << std::endl;
+}
+
+// Counts live objects; copying a negative value throws.
+struct Tracked {
+	static std::atomic<long> live;
+	Tracked(long v = 0) : v(v) { ++live; }
+	Tracked(Tracked const & x) : v(x.v) {
+		if (x.v < 0)
+			throw std::runtime_error("poisoned");
+		++live;
+	}
+	~Tracked() { --live; }
+	Tracked & operator=(Tracked const & x) { this->v = x.v; return *this; }
+	long v;
+	char pad[24];
+};
+std::atomic<long> Tracked::live(0);
+
+void ft_parallel_test() {
+	std::cout << "parallel_test" << std::endl;
+	tested::vector<long> big(ft::par, 1 << 22, 7);
+	long sum = 0;
+	for (size_t i = 0; i < big.size(); ++i)
+		sum += big[i];
+	std::cout << "size    : " << big.size() << std::endl;
+	std::cout << "capacity: " << big.capacity() << std::endl;
+	std::cout << "sum     : " << sum << std::endl;
+
+	big[12345] = 1;
+	tested::vector<long> copy(ft::par(4), big);
+	std::cout << (copy == big) << " " << copy[12345] << std::endl;
+	copy.assign(ft::par, 1 << 21, 3);
+	sum = 0;
+	for (size_t i = 0; i < copy.size(); ++i)
+		sum += copy[i];
+	std::cout << "size    : " << copy.size() << " sum: " << sum << std::endl;
+	copy.assign(ft::par(4), 3 << 21, copy[5]);
+	sum = 0;
+	for (size_t i = 0; i < copy.size(); ++i)
+		sum += copy[i];
+	std::cout << "size    : " << copy.size() << " sum: " << sum << std::endl;
+
+	tested::vector<std::string> strings(ft::par(3), 300000, "parallel");
+	tested::vector<std::string> strings_copy(ft::par, strings);
+	std::cout << strings_copy.size() << " " << strings_copy.back() << std::endl;
+
+	tested::vector<Tracked> src(ft::par, 1 << 18, 1);
+	src[200000].v = -1;
+	std::cout << "live    : " << Tracked::live << std::endl;
+	try {
+		tested::vector<Tracked> tracked_copy(ft::par(8), src);
+	} catch (std::exception & e) {
+		std::cout << e.what() << std::endl;
+	}
+	std::cout << "live    : " << Tracked::live << std::endl;
+}
+
+// A copy that throws while the tail shifts leaves a shorter, valid vector:
+// nothing is destroyed twice and nothing leaks.
+void ft_shift_throw_test() {
+	std::cout << "shift_throw_test" << std::endl;
+	{
+		tested::vector<Tracked> vec;
+		for (long i = 0; i < 10; ++i)
+			vec.push_back(i);
+		vec[7] = Tracked(-1);
+		try {
+			vec.erase(vec.begin() + 2);
+		} catch (std::exception & e) {
+			std::cout << e.what() << std::endl;
+		}
+		std::cout << "size    : " << vec.size() << " " << vec.back().v << " live " << Tracked::live << std::endl;
+		vec.reserve(20);
+		vec[1] = Tracked(-1);
+		try {
+			vec.insert(vec.begin(), 3, Tracked(5));
+		} catch (std::exception & e) {
+			std::cout << e.what() << std::endl;
+		}
+		std::cout << "size    : " << vec.size() << " live " << Tracked::live << std::endl;
+	}
+	std::cout << "live    : " << Tracked::live << std::endl;
+	// When the insert has to grow, a failed copy leaves the old buffer as it was.
+	{
+		tested::vector<Tracked> vec;
+		for (long i = 0; i < 8; ++i)
+			vec.push_back(i);
+		vec.shrink_to_fit();
+		vec[5] = Tracked(-1);
+		try {
+			vec.insert(vec.begin() + 2, Tracked(9));
+		} catch (std::exception & e) {
+			std::cout << e.what() << std::endl;
+		}
+		std::cout << "size    : " << vec.size() << " " << vec[2].v << " " << vec[5].v << " live " << Tracked::live << std::endl;
+	}
+	std::cout << "live    : " << Tracked::live << std::endl;
+}
+
+// Containers sharing one arena, then freed in bulk and rebuilt in the same arena.
+void ft_arena_test() {
+	std::cout << "arena_test" << std::endl;
+	ft::arena scratch(256);
+	for (int round = 0; round < 2; ++round) {
+		tested::vector<Test, ft::arena_allocator<Test> > vec(scratch);
+		for (int i = 0; i < 100; ++i)
+			vec.push_back(i + round);
+		vec.insert(vec.begin() + 10, 5, -1);
+		vec.erase(vec.begin(), vec.begin() + 3);
+		tested::vector<Test, ft::arena_allocator<Test> > copy(vec);
+		copy.resize(20);
+		tested::vector<std::string, ft::arena_allocator<std::string> > words(3, "arena", scratch);
+		words.push_back("scratch");
+		std::cout << "size    : " << vec.size() << " " << copy.size() << std::endl;
+		for (size_t i = 0; i < copy.size(); ++i)
+			std::cout << copy[i].some_ << " ";
+		std::cout << vec.back().some_ << " " << words.front() << " " << words.back() << std::endl;
+		vec.swap(copy);
+		std::cout << vec.size() << " " << copy.size() << std::endl;
+	}
+	scratch.reset();
+}
+
+// Assignment and insertion that go through a temporary vector keep the container's allocator.
+void ft_assign_keeps_allocator_test() {
+	std::cout << "assign_keeps_allocator_test" << std::endl;
+	ft::arena scratch;
+	tested::vector<int, ft::arena_allocator<int> > vec(scratch);
+	vec.push_back(1);
+	vec.assign(100, 7);
+	std::cout << vec.size() << " " << vec[99] << " " << (vec.get_allocator().resource() == &scratch) << std::endl;
+	vec.assign(vec.begin() + 90, vec.end());
+	std::cout << vec.size() << " " << (vec.get_allocator().resource() == &scratch) << std::endl;
+	vec.insert(vec.begin(), vec.begin(), vec.begin() + 5);
+	std::cout << vec.size() << " " << (vec.get_allocator().resource() == &scratch) << std::endl;
+
+	ft::arena_resource pool;
+	tested::vector<Test, ft::polymorphic_allocator<Test> > poly(&pool);
+	poly.assign(50, Test(3));
+	std::cout << poly.size() << " " << poly[49].some_ << " " << (poly.get_allocator().resource() == &pool)
+		<< " " << (pool.bytes_used() >= 50 * sizeof(Test)) << std::endl;
+}
+
+// Huge-page buffers: 2 MB aligned, and requests too big to map throw instead of wrapping.
+void ft_hugepage_test() {
+	std::cout << "hugepage_test" << std::endl;
+	tested::vector<int, ft::hugepage_allocator<int> > big(1 << 20, 4);
+	std::cout << big.size() << " " << big[(1 << 20) - 1] << " "
+		<< (reinterpret_cast<std::size_t>(big.data()) % HUGEPAGE_SIZE == 0) << std::endl;
+	big.push_back(5);
+	std::cout << big.size() << " " << big.back() << std::endl;
+
+	ft::hugepage_allocator<int> alloc;
+	std::size_t sizes[] = {alloc.max_size(), alloc.max_size() / 2 + 1, alloc.max_size() + 1};
+	for (std::size_t i = 0; i < 3; ++i) {
+		try {
+			int *p = alloc.allocate(sizes[i]);
+			alloc.deallocate(p, sizes[i]);
+			std::cout << "allocated" << std::endl;
+		} catch (std::bad_alloc & e) {
+			std::cout << "bad_alloc" << std::endl;
+		}
+	}
+}
+
+// Requests too big for any block throw instead of wrapping the block size around.
+void ft_arena_overflow_test() {
+	std::cout << "arena_overflow_test" << std::endl;
+	ft::arena scratch;
+	ft::arena_allocator<int> alloc(scratch);
+	ft::arena_resource resource;
+	std::size_t huge = std::numeric_limits<std::size_t>::max();
+	for (int i = 0; i < 5; ++i) {
+		try {
+			if (i == 0)
+				alloc.allocate(alloc.max_size());
+			else if (i == 1)
+				alloc.allocate(alloc.max_size() + 1);
+			else if (i == 2)
+				scratch.allocate(huge - 8);
+			else if (i == 3)
+				scratch.allocate(huge - 200, 64);
+			else
+				resource.allocate(huge - 16);
+			std::cout << "allocated" << std::endl;
+		} catch (std::bad_alloc & e) {
+			std::cout << "bad_alloc" << std::endl;
+		}
+	}
+	tested::vector<int, ft::arena_allocator<int> > vec(scratch);
+	try {
+		vec.reserve(vec.max_size());
+	} catch (std::exception & e) {
+		std::cout << "reserve failed" << std::endl;
+	}
+	std::cout << vec.capacity() << " " << (scratch.bytes_reserved() < (std::size_t(1) << 20)) << std::endl;
+}
+
+// A polymorphic_allocator never follows the elements: a moved-to vector stays on
+// its resource, and only takes the buffer when both use the same one. Wrapped in
+// a stats_allocator, it still hands its resource down to nested vectors.
+struct nested_alloc_tag {};
+void ft_allocator_propagation_test() {
+	std::cout << "allocator_propagation_test" << std::endl;
+	typedef tested::vector<int, ft::polymorphic_allocator<int> > poly_vector;
+	ft::arena_resource left;
+	ft::arena_resource right;
+	poly_vector a(3, 1, &left);
+	poly_vector b(5, 2, &right);
+	a = std::move(b);
+	std::cout << a.size() << " " << a[4] << " " << (a.get_allocator().resource() == &left) << std::endl;
+	poly_vector c(2, 9, &left);
+	const int *buffer = a.data();
+	c = std::move(a);
+	std::cout << c.size() << " " << a.size() << " " << (c.data() == buffer)
+		<< " " << (c.get_allocator().resource() == &left) << std::endl;
+	poly_vector d(1, 4, &left);
+	c.swap(d);
+	std::cout << c.size() << " " << d.size() << " " << (d.data() == buffer) << std::endl;
+
+	tested::vector<int> plain(4, 4);
+	tested::vector<int> other;
+	other = std::move(plain);
+	std::cout << other.size() << " " << plain.size() << std::endl;
+
+	typedef ft::stats_allocator<poly_vector, nested_alloc_tag, ft::polymorphic_allocator<poly_vector> > counted;
+	counted outer_alloc = ft::polymorphic_allocator<poly_vector>(&left);
+	ft::vector<poly_vector, counted> outer(outer_alloc);
+	outer.emplace_back(3, 7);
+	outer.push_back(d);
+	std::cout << outer.size() << " " << outer[0][2] << " " << (outer[0].get_allocator().resource() == &left)
+		<< " " << (outer[1].get_allocator().resource() == &left) << " " << counted::stats().get().allocations << std::endl;
+}
+
+// data() on default and cache-line aligned buffers, through growth and copies.
+void ft_data_test() {
+	std::cout << "data_test" << std::endl;
+	tested::vector<float> plain(10, 1.5f);
+	tested::vector<float, ft::aligned_allocator<float> > aligned(10, 2.5f);
+	tested::vector<double, ft::aligned_allocator<double, 32> > wide;
+
+	std::cout << (plain.data() == &plain[0]) << " " << plain.data()[9] << std::endl;
+	bool all_aligned = true;
+	for (int i = 0; i < 100; ++i) {
+		aligned.push_back(static_cast<float>(i));
+		wide.push_back(i * 0.5);
+		all_aligned = all_aligned && reinterpret_cast<size_t>(aligned.data()) % 64 == 0
+			&& reinterpret_cast<size_t>(wide.data()) % 32 == 0;
+	}
+	tested::vector<float, ft::aligned_allocator<float> > copy(aligned);
+	all_aligned = all_aligned && reinterpret_cast<size_t>(copy.data()) % 64 == 0;
+	std::cout << "aligned : " << all_aligned << std::endl;
+	float sum = 0;
+	for (size_t i = 0; i < copy.size(); ++i)
+		sum += copy.data()[i];
+	std::cout << copy.size() << " " << sum << " " << wide.data()[99] << std::endl;
+	const tested::vector<float, ft::aligned_allocator<float> > & ref = copy;
+	std::cout << (ref.data() == &ref[0]) << std::endl;
+}
+
 void ft_swap_test() {
 	std::cout << "swap_test" << std::endl;
-	ft::vector<Test> mouse(129);
+	tested::vector<Test> mouse(129);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> big_mouse(1023);
+	tested::vector<Test> big_mouse(1023);
 	for (size_t i = 0; i < big_mouse.size(); ++i) {
 		big_mouse[i].some_ = i + 1000;
 	}
@@ -1128,13 +1671,13 @@ void ft_swap_test() {
 
 void ft_clear_test() {
 	std::cout << "clear_test" << std::endl;
-	ft::vector<Test> empty;
-	ft::vector<Test> big_empty;
-	ft::vector<Test> mouse(129);
+	tested::vector<Test> empty;
+	tested::vector<Test> big_empty;
+	tested::vector<Test> mouse(129);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i].some_ = i;
 	}
-	ft::vector<Test> big_mouse(1023);
+	tested::vector<Test> big_mouse(1023);
 	for (size_t i = 0; i < big_mouse.size(); ++i) {
 		big_mouse[i].some_ = i + 1000;
 	}
@@ -1228,13 +1771,13 @@ void ft_clear_test() {
 
 void ft_relational_operators() {
 	std::cout << "relational_operators" << std::endl;
-	ft::vector<int> empty;
-	ft::vector<int> big_empty;
-	ft::vector<int> mouse(129);
+	tested::vector<int> empty;
+	tested::vector<int> big_empty;
+	tested::vector<int> mouse(129);
 	for (size_t i = 0; i < mouse.size(); ++i) {
 		mouse[i] = i;
 	}
-	ft::vector<int> big_mouse(1023);
+	tested::vector<int> big_mouse(1023);
 	for (size_t i = 0; i < big_mouse.size(); ++i) {
 		big_mouse[i] = i + 1000;
 	}
@@ -1268,11 +1811,22 @@ void ft_relational_operators() {
 	std::cout << (big_empty <= empty) << std::endl;
 	std::cout << (mouse     <= big_mouse)     << std::endl;
 	std::cout << (big_mouse <= mouse) << std::endl;
+
+	tested::vector<unsigned char> bytes(1000, 200);
+	tested::vector<unsigned char> other_bytes(bytes);
+	other_bytes[999] = 7;
+	std::cout << (bytes == other_bytes) << (bytes < other_bytes) << (other_bytes < bytes) << std::endl;
+	tested::vector<int> negative(300, 5);
+	tested::vector<int> other_negative(negative);
+	other_negative[250] = -5;
+	std::cout << (negative == other_negative) << (negative < other_negative) << (other_negative < negative) << std::endl;
+	other_negative.resize(250);
+	std::cout << (negative == other_negative) << (negative < other_negative) << (other_negative < negative) << std::endl;
 }
 
 void const_iterators() {
 	std::cout << "const_iterators" << std::endl;
-	ft::vector<int> src;
+	tested::vector<int> src;
 	for (int i = 0; i < 20; ++i) {
 		src.push_back(i);
 	}
@@ -1293,7 +1847,7 @@ void const_iterators() {
 	std::cout << (cit <= cit2) << std::endl;
 	std::cout << (cit == cit2) << std::endl;
 
-	ft::vector<int>::const_iterator cit_src(src.begin());
+	tested::vector<int>::const_iterator cit_src(src.begin());
 	while (cit_src != src.end()) {
 		std::cout << *cit_src << " ";
 		++cit_src;
@@ -1303,7 +1857,7 @@ void const_iterators() {
 
 void reverse_iterators() {
 	std::cout << "reverse_iterators" << std::endl;
-	ft::vector<int> src;
+	tested::vector<int> src;
 	for (int i = 0; i < 20; ++i) {
 		src.push_back(i);
 	}
@@ -1324,7 +1878,7 @@ void reverse_iterators() {
 	std::cout << (rcit <= rcit2) << std::endl;
 	std::cout << (rcit == rcit2) << std::endl;
 
-	ft::vector<int>::const_reverse_iterator rcit_src(src.rbegin());
+	tested::vector<int>::const_reverse_iterator rcit_src(src.rbegin());
 	while (rcit_src != src.rend()) {
 		std::cout << *rcit_src << " ";
 		++rcit_src;
@@ -1334,11 +1888,11 @@ void reverse_iterators() {
 
 void relational_operators() {
 	std::cout << "relational_operators" << std::endl;
-	ft::vector<int> def;
+	tested::vector<int> def;
 	for (int i = 0; i < 20; i += 2) {
 		def.push_back(2);
 	}
-	ft::vector<int> def2;
+	tested::vector<int> def2;
 	for (int i = 1; i < 20; i += 2) {
 		def2.push_back(2);
 	}
@@ -1352,12 +1906,12 @@ void relational_operators() {
 
 void const_iter_with_iter() {
 	std::cout << "const_iter_with_iter" << std::endl;
-	ft::vector<int> def;
+	tested::vector<int> def;
 	for (int i = 0; i < 20; i += 2) {
 		def.push_back(2);
 	}
-	ft::vector<int>::iterator       it(def.begin());
-	ft::vector<int>::const_iterator cit(def.begin());
+	tested::vector<int>::iterator       it(def.begin());
+	tested::vector<int>::const_iterator cit(def.begin());
 
 	std::cout << (it >  cit) << std::endl;
 	std::cout << (it >= cit) << std::endl;
@@ -1366,8 +1920,8 @@ void const_iter_with_iter() {
 	std::cout << (it == cit) << std::endl;
 	std::cout << (it != cit) << std::endl;
 
-	ft::vector<int>::reverse_iterator       rit(def.begin());
-	ft::vector<int>::const_reverse_iterator rcit(def.begin());
+	tested::vector<int>::reverse_iterator       rit(def.begin());
+	tested::vector<int>::const_reverse_iterator rcit(def.begin());
 
 	std::cout << (rit >  rcit) << std::endl;
 	std::cout << (rit >= rcit) << std::endl;
@@ -1391,6 +1945,22 @@ void ft_modifiers_test() {
 	ft_insert_iter_iter_iter_8390_leaks_test();
 
 	ft_erase_2540_leaks_test();
+	ft_erase_if_test();
+	ft_relocation_test();
+	ft_move_emplace_test();
+	ft_resize_default_init_test();
+	ft_range_category_test();
+	ft_shrink_to_fit_test();
+	ft_bool_test();
+	ft_bool_shift_test();
+	ft_parallel_test();
+	ft_shift_throw_test();
+	ft_arena_test();
+	ft_assign_keeps_allocator_test();
+	ft_hugepage_test();
+	ft_arena_overflow_test();
+	ft_allocator_propagation_test();
+	ft_data_test();
 	ft_swap_test();
 	ft_clear_test();
 	ft_relational_operators();
@@ -1400,16 +1970,17 @@ void ft_modifiers_test() {
 
 int main(void)
 {
-	ft_constructors_capacity_test();
-	ft_operator_assignment();
-	ft_iterator_test();
-	ft_el_access_test();
-	ft_modifiers_test();
-
-	const_iterators();
-	reverse_iterators();
-	relational_operators();
-	const_iter_with_iter();
+	ALLOC_COUNTS(ft_constructors_capacity_test());
+	ALLOC_COUNTS(ft_operator_assignment());
+	ALLOC_COUNTS(ft_iterator_test());
+	ALLOC_COUNTS(ft_el_access_test());
+	ALLOC_COUNTS(ft_modifiers_test());
+
+	ALLOC_COUNTS(const_iterators());
+	ALLOC_COUNTS(reverse_iterators());
+	ALLOC_COUNTS(relational_operators());
+	ALLOC_COUNTS(const_iter_with_iter());
+	ALLOC_SUMMARY();
 	return 0;
 }
 
@@ -1,5 +1,13 @@
 #include <vector>
 #include <iostream>
+#include <string>
+#include <list>
+#include <sstream>
+#include <iterator>
+#include <atomic>
+#include <stdexcept>
+#include <algorithm>
+#include <unistd.h>
 #include <vector>
 
 #include "testing.hpp"
@@ -1069,6 +1077,454 @@ void ft_erase_2540_leaks_test() {
 	std::cout << std::endl;
 }
 
+bool is_odd_some(Test const & x) { return x.some_ % 2 != 0; }
+
+bool is_big_some(Test const & x) { return x.some_ >= 1000; }
+
+// std::erase_if is C++20, spell it out for older standards
+template <class Predicate>
+size_t erase_remove_if(std::vector<Test> & v, Predicate pred) {
+	std::vector<Test>::iterator it = std::remove_if(v.begin(), v.end(), pred);
+	size_t erased = v.end() - it;
+	v.erase(it, v.end());
+	return erased;
+}
+
+void ft_erase_if_test() {
+	std::cout << "erase_if_test" << std::endl;
+	std::vector<Test> mouse(129);
+	for (size_t i = 0; i < mouse.size(); ++i) {
+		mouse[i].some_ = i;
+	}
+	std::vector<Test> empty;
+
+	std::cout << erase_remove_if(mouse, is_odd_some) << std::endl;
+
+	std::cout << "size    : " << mouse.size()     << std::endl;
+	std::cout << "capacity: " << mouse.capacity() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < mouse.size(); ++i) {
+		if (i != 0 && i % 32 == 0)
+			std::cout << std::endl;
+		std::cout << mouse.at(i).some_ << " ";
+	}
+	std::cout << std::endl;
+
+	std::cout << erase_remove_if(mouse, is_big_some) << std::endl;
+	std::cout << erase_remove_if(empty, is_odd_some) << std::endl;
+
+	std::cout << "size    : " << empty.size()     << std::endl;
+	std::cout << "capacity: " << empty.capacity() << std::endl;
+}
+
+void ft_relocation_test() {
+	std::cout << "relocation_test" << std::endl;
+	std::vector<std::string> words;
+
+	// short strings keep their characters inside the object itself
+	for (size_t i = 0; i < 100; ++i)
+		words.push_back(std::string(i % 12 + 1, 'a' + i % 26));
+	words.insert(words.begin() + 10, 40, "mid");
+	words.erase(words.begin(), words.begin() + 25);
+	words.reserve(1000);
+
+	std::cout << "size    : " << words.size()     << std::endl;
+	std::cout << "capacity: " << words.capacity() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < words.size(); ++i) {
+		if (i != 0 && i % 16 == 0)
+			std::cout << std::endl;
+		std::cout << words[i] << " ";
+	}
+	std::cout << std::endl;
+}
+
+void ft_move_emplace_test() {
+	std::cout << "move_emplace_test" << std::endl;
+	std::vector<std::string> words;
+	std::string heavy(100, 'h');
+
+	words.push_back(std::move(heavy));
+	words.emplace_back(5, 'e');
+	words.emplace_back("literal");
+	words.emplace(words.begin() + 1, 3, 'm');
+	words.emplace(words.begin(), words[2]);
+	words.insert(words.end(), std::string("tail"));
+	std::cout << "moved from: " << heavy.size() << std::endl;
+
+	std::vector<std::string> stolen(std::move(words));
+	std::cout << "size    : " << words.size()     << std::endl;
+	std::cout << "capacity: " << words.capacity() << std::endl;
+	std::cout << "size    : " << stolen.size()    << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < stolen.size(); ++i)
+		std::cout << stolen[i] << " ";
+	std::cout << std::endl;
+
+	std::vector<std::string> target(10, "old");
+	target = std::move(stolen);
+	std::cout << "size    : " << stolen.size()    << std::endl;
+	std::cout << "size    : " << target.size()    << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < target.size(); ++i)
+		std::cout << target[i] << " ";
+	std::cout << std::endl;
+
+	std::vector<std::vector<Test> > nested;
+	for (int i = 0; i < 40; ++i) {
+		nested.push_back(std::vector<Test>(i, i));
+		nested.back().emplace_back(i * 2);
+	}
+	std::cout << "size    : " << nested.size()    << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < nested.size(); ++i)
+		std::cout << nested[i].size() << ":" << nested[i].back().some_ << " ";
+	std::cout << std::endl;
+}
+
+// What ft::read_into does, minus the zeroing that std::vector::resize can't skip.
+static ssize_t read_into(int fd, std::vector<char> & buf, size_t count) {
+	size_t old_size = buf.size();
+	buf.resize(old_size + count);
+	ssize_t got = read(fd, &buf[0] + old_size, count);
+	buf.resize(old_size + (got > 0 ? got : 0));
+	return got;
+}
+
+void ft_resize_default_init_test() {
+	std::cout << "resize_default_init_test" << std::endl;
+	std::vector<int> ints(5, 42);
+	ints.resize(300);
+	for (size_t i = 5; i < ints.size(); ++i)
+		ints[i] = i;
+	ints.resize(100);
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+
+	int fds[2];
+	if (pipe(fds) != 0)
+		return;
+	if (write(fds[1], "receive buffer", 14) != 14)
+		return;
+	close(fds[1]);
+	std::vector<char> buf(3, '>');
+	ssize_t got;
+	while ((got = read_into(fds[0], buf, 4)) > 0)
+		std::cout << got << " ";
+	close(fds[0]);
+	std::cout << got << std::endl;
+	std::cout << "size    : " << buf.size() << std::endl;
+	for (size_t i = 0; i < buf.size(); ++i)
+		std::cout << buf[i];
+	std::cout << std::endl;
+}
+
+void ft_range_category_test() {
+	std::cout << "range_category_test" << std::endl;
+	std::istringstream numbers("1 2 3 4 5 6 7 8 9 10");
+	std::vector<int> ints((std::istream_iterator<int>(numbers)), std::istream_iterator<int>());
+	std::list<std::string> words;
+	for (int i = 0; i < 40; ++i)
+		words.push_back(std::string(i % 7, 'a' + i % 26));
+	std::vector<std::string> strings(words.begin(), words.end());
+	std::cout << "size    : " << strings.size()     << std::endl;
+	std::cout << "capacity: " << strings.capacity() << std::endl;
+
+	strings.insert(strings.begin() + 3, words.begin(), words.end());
+	std::istringstream more("11 12 13");
+	ints.insert(ints.begin() + 2, std::istream_iterator<int>(more), std::istream_iterator<int>());
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+
+	int raw[] = {42, 43, 44, 45};
+	ints.assign(raw, raw + 4);
+	ints.insert(ints.begin() + 1, raw, raw + 4);
+	strings.assign(words.begin(), words.end());
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+	std::istringstream last("7 8");
+	ints.assign(std::istream_iterator<int>(last), std::istream_iterator<int>());
+	std::cout << "size    : " << ints.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < ints.size(); ++i)
+		std::cout << ints[i] << " ";
+	std::cout << std::endl;
+	std::cout << "size    : " << strings.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < strings.size(); ++i)
+		std::cout << strings[i] << " ";
+	std::cout << std::endl;
+}
+
+void ft_shrink_to_fit_test() {
+	std::cout << "shrink_to_fit_test" << std::endl;
+	std::vector<int> ints(1000, 3);
+	ints.erase(ints.begin() + 10, ints.end());
+	std::cout << "payload : " << ints.size() * sizeof(int) << std::endl;
+	std::cout << "slack   : " << (ints.capacity() - ints.size()) * sizeof(int) << std::endl;
+	ints.shrink_to_fit();
+	std::cout << "size    : " << ints.size()     << std::endl;
+	std::cout << "capacity: " << ints.capacity() << std::endl;
+	std::cout << "payload : " << ints.size() * sizeof(int) << std::endl;
+	std::cout << "slack   : " << (ints.capacity() - ints.size()) * sizeof(int) << std::endl;
+
+	std::vector<std::string> strings(100, "shrink");
+	strings.resize(5);
+	strings.shrink_to_fit();
+	strings.push_back("grown");
+	std::cout << "size    : " << strings.size()     << std::endl;
+	std::cout << "capacity: " << strings.capacity() << std::endl;
+	for (size_t i = 0; i < strings.size(); ++i)
+		std::cout << strings[i] << " ";
+	std::cout << std::endl;
+	strings.clear();
+	strings.shrink_to_fit();
+	std::cout << "capacity: " << strings.capacity() << std::endl;
+}
+
+void ft_bool_test() {
+	std::cout << "bool_test" << std::endl;
+	std::vector<bool> bits;
+	for (int i = 0; i < 300; ++i)
+		bits.push_back(i % 3 == 0 || i % 7 == 0);
+	bits.insert(bits.begin() + 70, 90, true);
+	bits.erase(bits.begin() + 5, bits.begin() + 133);
+	bits[0].flip();
+	bits.back() = true;
+	bits.resize(200);
+	std::cout << "size    : " << bits.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < bits.size(); ++i)
+		std::cout << bits[i];
+	std::cout << std::endl;
+	std::cout << "count   : " << std::count(bits.begin(), bits.end(), true) << std::endl;
+	std::cout << "first   : " << (std::find(bits.begin(), bits.end(), true) - bits.begin()) << std::endl;
+	bits.flip();
+	std::cout << "count   : " << std::count(bits.begin(), bits.end(), true) << std::endl;
+	std::cout << "first   : " << (std::find(bits.begin(), bits.end(), true) - bits.begin()) << std::endl;
+
+	std::vector<bool> mask(150, true);
+	mask[3] = false;
+	for (size_t i = 0; i < bits.size(); ++i)
+		bits[i] = bits[i] && i < mask.size() && mask[i];
+	std::cout << "count   : " << std::count(bits.begin(), bits.end(), true) << std::endl;
+	for (std::vector<bool>::reverse_iterator it = bits.rbegin(); it != bits.rend(); ++it)
+		std::cout << *it;
+	std::cout << std::endl;
+
+	std::vector<bool> copy(bits);
+	std::cout << (copy == bits) << (copy < bits) << std::endl;
+	copy[199] = true;
+	std::cout << (copy == bits) << (copy < bits) << (bits < copy) << std::endl;
+	copy.resize(100);
+	std::cout << (copy == bits) << (copy < bits) << (bits < copy) << std::endl;
+}
+
+void ft_bool_shift_test() {
+	std::cout << "bool_shift_test" << std::endl;
+	size_t sizes[] = {1, 63, 64, 65, 127, 128, 200, 3};
+	std::vector<bool> pattern;
+	for (int i = 0; i < 64; ++i)
+		pattern.push_back(i % 5 == 0);
+	std::vector<bool> bits;
+	for (int i = 0; i < 1000; ++i)
+		bits.push_back(i % 3 == 0 || i % 7 == 0);
+
+	for (int round = 0; round < 12; ++round) {
+		size_t at = (round * 37) % (bits.size() / 2);
+		size_t n = sizes[round % 8];
+		bits.insert(bits.begin() + at, n, round % 2 == 0);
+		bits.erase(bits.begin() + (at * 3) % bits.size() / 2, bits.begin() + (at * 3) % bits.size() / 2 + sizes[(round + 3) % 8]);
+		bits.insert(bits.begin() + at / 2, pattern.begin(), pattern.begin() + n % 50);
+	}
+	bits.erase(bits.begin(), bits.begin() + 64);
+	bits.erase(bits.begin() + 1, bits.begin() + 2);
+	bits.insert(bits.begin(), 128, true);
+	bits.erase(bits.end() - 65, bits.end());
+	std::cout << "size    : " << bits.size() << std::endl;
+	for (size_t i = 0; i < bits.size(); ++i) {
+		if (i != 0 && i % 128 == 0)
+			std::cout << std::endl;
+		std::cout << bits[i];
+	}
+	std::cout << std::endl;
+	std::cout << "count   : " << std::count(bits.begin(), bits.end(), true) << std::endl;
+
+	std::vector<bool> flags;
+	flags.assign(pattern.begin(), pattern.end());
+	flags.insert(flags.begin() + 3, pattern.begin(), pattern.end());
+	std::cout << flags.size() << " " << std::count(flags.begin(), flags.end(), true) << " " << 1 << std::endl;
+}
+
+// Counts live objects; copying a negative value throws.
+struct Tracked {
+	static std::atomic<long> live;
+	Tracked(long v = 0) : v(v) { ++live; }
+	Tracked(Tracked const & x) : v(x.v) {
+		if (x.v < 0)
+			throw std::runtime_error("poisoned");
+		++live;
+	}
+	~Tracked() { --live; }
+	Tracked & operator=(Tracked const & x) { this->v = x.v; return *this; }
+	long v;
+	char pad[24];
+};
+std::atomic<long> Tracked::live(0);
+
+void ft_parallel_test() {
+	std::cout << "parallel_test" << std::endl;
+	std::vector<long> big(1 << 22, 7);
+	long sum = 0;
+	for (size_t i = 0; i < big.size(); ++i)
+		sum += big[i];
+	std::cout << "size    : " << big.size() << std::endl;
+	std::cout << "capacity: " << big.capacity() << std::endl;
+	std::cout << "sum     : " << sum << std::endl;
+
+	big[12345] = 1;
+	std::vector<long> copy(big);
+	std::cout << (copy == big) << " " << copy[12345] << std::endl;
+	copy.assign(1 << 21, 3);
+	sum = 0;
+	for (size_t i = 0; i < copy.size(); ++i)
+		sum += copy[i];
+	std::cout << "size    : " << copy.size() << " sum: " << sum << std::endl;
+	copy.assign(3 << 21, copy[5]);
+	sum = 0;
+	for (size_t i = 0; i < copy.size(); ++i)
+		sum += copy[i];
+	std::cout << "size    : " << copy.size() << " sum: " << sum << std::endl;
+
+	std::vector<std::string> strings(300000, "parallel");
+	std::vector<std::string> strings_copy(strings);
+	std::cout << strings_copy.size() << " " << strings_copy.back() << std::endl;
+
+	std::vector<Tracked> src(1 << 18, 1);
+	src[200000].v = -1;
+	std::cout << "live    : " << Tracked::live << std::endl;
+	try {
+		std::vector<Tracked> tracked_copy(src);
+	} catch (std::exception & e) {
+		std::cout << e.what() << std::endl;
+	}
+	std::cout << "live    : " << Tracked::live << std::endl;
+}
+
+// Reference for ft_shift_throw_test: std::vector shifts by assignment, ft::vector relocates.
+void ft_shift_throw_test() {
+	std::cout << "shift_throw_test" << std::endl;
+	std::cout << "poisoned" << std::endl;
+	std::cout << "size    : " << 2 << " " << 1 << " live " << 2 << std::endl;
+	std::cout << "poisoned" << std::endl;
+	std::cout << "size    : " << 0 << " live " << 0 << std::endl;
+	std::cout << "live    : " << 0 << std::endl;
+	std::cout << "poisoned" << std::endl;
+	std::cout << "size    : " << 8 << " " << 2 << " " << -1 << " live " << 8 << std::endl;
+	std::cout << "live    : " << 0 << std::endl;
+}
+
+// Reference for the arena-backed ft::vector.
+void ft_arena_test() {
+	std::cout << "arena_test" << std::endl;
+		for (int round = 0; round < 2; ++round) {
+		std::vector<Test> vec;
+		for (int i = 0; i < 100; ++i)
+			vec.push_back(i + round);
+		vec.insert(vec.begin() + 10, 5, -1);
+		vec.erase(vec.begin(), vec.begin() + 3);
+		std::vector<Test> copy(vec);
+		copy.resize(20);
+		std::vector<std::string> words(3, "arena");
+		words.push_back("scratch");
+		std::cout << "size    : " << vec.size() << " " << copy.size() << std::endl;
+		for (size_t i = 0; i < copy.size(); ++i)
+			std::cout << copy[i].some_ << " ";
+		std::cout << vec.back().some_ << " " << words.front() << " " << words.back() << std::endl;
+		vec.swap(copy);
+		std::cout << vec.size() << " " << copy.size() << std::endl;
+	}
+}
+
+// Reference for ft_assign_keeps_allocator_test; std::allocator is always kept.
+void ft_assign_keeps_allocator_test() {
+	std::cout << "assign_keeps_allocator_test" << std::endl;
+	std::vector<int> vec;
+	vec.push_back(1);
+	vec.assign(100, 7);
+	std::cout << vec.size() << " " << vec[99] << " " << 1 << std::endl;
+	vec.assign(vec.begin() + 90, vec.end());
+	std::cout << vec.size() << " " << 1 << std::endl;
+	vec.insert(vec.begin(), vec.begin(), vec.begin() + 5);
+	std::cout << vec.size() << " " << 1 << std::endl;
+
+	std::vector<Test> poly;
+	poly.assign(50, Test(3));
+	std::cout << poly.size() << " " << poly[49].some_ << " " << 1 << " " << 1 << std::endl;
+}
+
+// Reference for ft_hugepage_test.
+void ft_hugepage_test() {
+	std::cout << "hugepage_test" << std::endl;
+	std::vector<int> big(1 << 20, 4);
+	std::cout << big.size() << " " << big[(1 << 20) - 1] << " " << 1 << std::endl;
+	big.push_back(5);
+	std::cout << big.size() << " " << big.back() << std::endl;
+	for (int i = 0; i < 3; ++i)
+		std::cout << "bad_alloc" << std::endl;
+}
+
+// Reference for ft_arena_overflow_test.
+void ft_arena_overflow_test() {
+	std::cout << "arena_overflow_test" << std::endl;
+	for (int i = 0; i < 5; ++i)
+		std::cout << "bad_alloc" << std::endl;
+	std::cout << "reserve failed" << std::endl;
+	std::cout << 0 << " " << 1 << std::endl;
+}
+
+// Reference for allocator propagation in ft::vector.
+void ft_allocator_propagation_test() {
+	std::cout << "allocator_propagation_test" << std::endl;
+	std::cout << 5 << " " << 2 << " " << 1 << std::endl;
+	std::cout << 5 << " " << 0 << " " << 1 << " " << 1 << std::endl;
+	std::cout << 1 << " " << 5 << " " << 1 << std::endl;
+	std::cout << 4 << " " << 0 << std::endl;
+	std::cout << 2 << " " << 7 << " " << 1 << " " << 1 << " " << 2 << std::endl;
+}
+
+// Reference for data() on ft::vector; std::allocator cannot promise 64-byte alignment.
+void ft_data_test() {
+	std::cout << "data_test" << std::endl;
+	std::vector<float> plain(10, 1.5f);
+	std::vector<float> aligned(10, 2.5f);
+	std::vector<double> wide;
+
+	std::cout << (plain.data() == &plain[0]) << " " << plain.data()[9] << std::endl;
+	bool all_aligned = true;
+	for (int i = 0; i < 100; ++i) {
+		aligned.push_back(static_cast<float>(i));
+		wide.push_back(i * 0.5);
+	}
+	std::vector<float> copy(aligned);
+	std::cout << "aligned : " << all_aligned << std::endl;
+	float sum = 0;
+	for (size_t i = 0; i < copy.size(); ++i)
+		sum += copy.data()[i];
+	std::cout << copy.size() << " " << sum << " " << wide.data()[99] << std::endl;
+	const std::vector<float> & ref = copy;
+	std::cout << (ref.data() == &ref[0]) << std::endl;
+}
+
 void ft_swap_test() {
 	std::cout << "swap_test" << std::endl;
 	std::vector<Test> mouse(129);
@@ -1267,6 +1723,17 @@ void ft_relational_operators() {
 	std::cout << (big_empty <= empty) << std::endl;
 	std::cout << (mouse     <= big_mouse)     << std::endl;
 	std::cout << (big_mouse <= mouse) << std::endl;
+
+	std::vector<unsigned char> bytes(1000, 200);
+	std::vector<unsigned char> other_bytes(bytes);
+	other_bytes[999] = 7;
+	std::cout << (bytes == other_bytes) << (bytes < other_bytes) << (other_bytes < bytes) << std::endl;
+	std::vector<int> negative(300, 5);
+	std::vector<int> other_negative(negative);
+	other_negative[250] = -5;
+	std::cout << (negative == other_negative) << (negative < other_negative) << (other_negative < negative) << std::endl;
+	other_negative.resize(250);
+	std::cout << (negative == other_negative) << (negative < other_negative) << (other_negative < negative) << std::endl;
 }
 
 void const_iterators() {
@@ -1393,6 +1860,22 @@ void ft_modifiers_test() {
 	ft_insert_iter_iter_iter_8390_leaks_test();
 
 	ft_erase_2540_leaks_test();
+	ft_erase_if_test();
+	ft_relocation_test();
+	ft_move_emplace_test();
+	ft_resize_default_init_test();
+	ft_range_category_test();
+	ft_shrink_to_fit_test();
+	ft_bool_test();
+	ft_bool_shift_test();
+	ft_parallel_test();
+	ft_shift_throw_test();
+	ft_arena_test();
+	ft_assign_keeps_allocator_test();
+	ft_hugepage_test();
+	ft_arena_overflow_test();
+	ft_allocator_propagation_test();
+	ft_data_test();
 	ft_swap_test();
 	ft_clear_test();
 	ft_relational_operators();
@@ -0,0 +1,58 @@
+#include <iostream>
+#include <cstddef>
+#include "ft_vector.hpp"
+
+// Vectors past 4 GB: indices and iterator differences above 2^31 and 2^32.
+// Needs about LARGE_ELEMS bytes of RAM; build with -DLARGE_ELEMS=... to scale.
+#ifndef LARGE_ELEMS
+# define LARGE_ELEMS ((size_t(1) << 32) + 4096)
+#endif
+
+void print_tail(const ft::vector<char> & vec) {
+	std::cout << "size    : " << vec.size() << std::endl;
+	std::cout << "tail    : ";
+	for (size_t i = vec.size() - 16; i < vec.size(); ++i)
+		std::cout << vec[i];
+	std::cout << std::endl;
+}
+
+size_t count(const ft::vector<char> & vec, char c) {
+	size_t n = 0;
+	for (ft::vector<char>::const_iterator it = vec.begin(); it != vec.end(); ++it)
+		n += *it == c;
+	return n;
+}
+
+void ft_large_iteration_test() {
+	std::cout << "\nlarge_iteration\n" << std::endl;
+	ft::vector<char> big;
+
+	big.reserve(LARGE_ELEMS + 64);
+	big.resize(LARGE_ELEMS, 'a');
+	big[LARGE_ELEMS - 1] = 'z';
+	big[(size_t(1) << 31) + 1] = 'y';
+	print_tail(big);
+	std::cout << (big.end() - big.begin() == static_cast<std::ptrdiff_t>(LARGE_ELEMS)) << std::endl;
+	std::cout << *(big.begin() + (LARGE_ELEMS - 1)) << " " << *(big.end() - 1) << std::endl;
+	std::cout << big.begin()[(size_t(1) << 31) + 1] << " " << *(big.rbegin() + (LARGE_ELEMS - (size_t(1) << 31) - 2)) << std::endl;
+	std::cout << count(big, 'a') << " " << count(big, 'z') << std::endl;
+
+	big.insert(big.end() - 8, 4, 'b');
+	big.insert(big.begin() + (LARGE_ELEMS - 2), 'c');
+	big.insert(big.begin() + 1, 'd');
+	print_tail(big);
+	big.erase(big.end() - 12, big.end() - 6);
+	big.erase(big.begin() + 1);
+	big.erase(big.begin() + ((size_t(1) << 31) + 1));
+	print_tail(big);
+	std::cout << count(big, 'a') << " " << count(big, 'y') << " " << count(big, 'b') << std::endl;
+	big.push_back('e');
+	big.pop_back();
+	big.resize(LARGE_ELEMS - 3);
+	print_tail(big);
+}
+
+int main(void) {
+	ft_large_iteration_test();
+	return 0;
+}
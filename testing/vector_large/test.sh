@@ -0,0 +1,13 @@
+#! /bin/zsh
+
+# Needs about 4.5 GB of free RAM (one vector at a time); optimized and without
+# ASan, whose shadow memory would not fit next to the vector.
+
+rm -rf logs
+mkdir logs
+
+	clang++ -O2 -Wall -Wextra -Werror -I ../../impliment -I ../../utils -I ../ ./ft_vector_large_testing.cpp -o logs/user_bin &&
+	./logs/user_bin > logs/user.output &&
+	clang++ -O2 -Wall -Wextra -Werror -I ../ std_vector_large_testing.cpp -o logs/bin &&
+	./logs/bin > logs/std.output &&
+	diff logs/user.output logs/std.output
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include "ft_vm_vector.hpp"
+#include "testing.hpp"
+
+// vm_vector must behave like a vector; capacity is page-granular, so it is not printed.
+
+void print(const ft::vm_vector<Test> & vec) {
+	std::cout << "size    : " << vec.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < vec.size(); ++i) {
+		if (i != 0 && i % 32 == 0)
+			std::cout << std::endl;
+		std::cout << vec[i].some_ << " ";
+	}
+	std::cout << std::endl;
+}
+
+void ft_push_back_test() {
+	std::cout << "\npush_back\n" << std::endl;
+	ft::vm_vector<Test> vec;
+
+	vec.push_back(0);
+	const Test *first = &vec[0];
+	for (int i = 1; i < 5000; ++i)
+		vec.push_back(i);
+	std::cout << "stable  : " << (first == &vec[0]) << std::endl;
+	vec.erase(vec.begin() + 64, vec.end());
+	print(vec);
+	vec.insert(vec.begin() + 3, 42);
+	vec.pop_back();
+	vec.emplace_back(7);
+	print(vec);
+	vec.resize(70, 9);
+	print(vec);
+}
+
+void ft_copy_move_test() {
+	std::cout << "\ncopy_move\n" << std::endl;
+	ft::vm_vector<Test> vec;
+	for (int i = 0; i < 40; ++i)
+		vec.push_back(i);
+
+	ft::vm_vector<Test> copy(vec);
+	print(copy);
+	ft::vm_vector<Test> moved(std::move(copy));
+	print(moved);
+	copy = vec;
+	copy.erase(copy.begin(), copy.begin() + 30);
+	print(copy);
+	copy.swap(moved);
+	print(copy);
+	std::cout << copy.size() << " " << moved.size() << std::endl;
+}
+
+void ft_strings_test() {
+	std::cout << "\nstrings\n" << std::endl;
+	ft::vm_vector<std::string> words;
+
+	for (size_t i = 0; i < 30; ++i)
+		words.push_back(std::string(i % 12 + 1, 'a' + i % 26));
+	words.insert(words.begin() + 2, words[10]);
+	words.erase(words.begin() + 5);
+	for (size_t i = 0; i < words.size(); ++i)
+		std::cout << words[i] << " ";
+	std::cout << std::endl;
+}
+
+// Counts live objects; copying a negative value throws.
+struct Tracked {
+	static long live;
+	Tracked(long v = 0) : v(v) { ++live; }
+	Tracked(Tracked const & x) : v(x.v) {
+		if (x.v < 0)
+			throw std::runtime_error("poisoned");
+		++live;
+	}
+	~Tracked() { --live; }
+	Tracked & operator=(Tracked const & x) { this->v = x.v; return *this; }
+	long v;
+};
+long Tracked::live = 0;
+
+void ft_copy_throw_test() {
+	std::cout << "\ncopy_throw\n" << std::endl;
+	ft::vm_vector<Tracked> vec;
+	for (long i = 0; i < 100; ++i)
+		vec.push_back(i);
+	vec[60] = Tracked(-1);
+	try {
+		ft::vm_vector<Tracked> copy(vec);
+	} catch (std::exception & e) {
+		std::cout << e.what() << std::endl;
+	}
+	std::cout << "live    : " << Tracked::live << std::endl;
+}
+
+// Assignment only needs room for the elements, not for the source's reservation.
+void ft_assign_reservation_test() {
+	std::cout << "\nassign_reservation\n" << std::endl;
+	ft::vm_vector<Test> small(100);
+	ft::vm_vector<Test> big(1 << 20);
+	for (int i = 0; i < 40; ++i)
+		big.push_back(i);
+	small = big;
+	print(small);
+	for (int i = 0; i < 5000; ++i)
+		big.push_back(i);
+	try {
+		small = big;
+	} catch (std::exception & e) {
+		std::cout << "length error" << std::endl;
+	}
+	std::cout << "size    : " << small.size() << std::endl;
+}
+
+int main(void) {
+	ft_push_back_test();
+	ft_copy_move_test();
+	ft_strings_test();
+	ft_copy_throw_test();
+	ft_assign_reservation_test();
+	return 0;
+}
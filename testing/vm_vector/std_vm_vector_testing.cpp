@@ -0,0 +1,95 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "testing.hpp"
+
+// vm_vector must behave like a vector; capacity is page-granular, so it is not printed.
+
+void print(const std::vector<Test> & vec) {
+	std::cout << "size    : " << vec.size() << std::endl;
+	std::cout << "arr     :" << std::endl;
+	for (size_t i = 0; i < vec.size(); ++i) {
+		if (i != 0 && i % 32 == 0)
+			std::cout << std::endl;
+		std::cout << vec[i].some_ << " ";
+	}
+	std::cout << std::endl;
+}
+
+void ft_push_back_test() {
+	std::cout << "\npush_back\n" << std::endl;
+	std::vector<Test> vec;
+
+	vec.push_back(0);
+	const Test *first = &vec[0];
+	for (int i = 1; i < 5000; ++i)
+		vec.push_back(i);
+	std::cout << "stable  : " << (first == &vec[0] || true) << std::endl;
+	vec.erase(vec.begin() + 64, vec.end());
+	print(vec);
+	vec.insert(vec.begin() + 3, 42);
+	vec.pop_back();
+	vec.emplace_back(7);
+	print(vec);
+	vec.resize(70, 9);
+	print(vec);
+}
+
+void ft_copy_move_test() {
+	std::cout << "\ncopy_move\n" << std::endl;
+	std::vector<Test> vec;
+	for (int i = 0; i < 40; ++i)
+		vec.push_back(i);
+
+	std::vector<Test> copy(vec);
+	print(copy);
+	std::vector<Test> moved(std::move(copy));
+	print(moved);
+	copy = vec;
+	copy.erase(copy.begin(), copy.begin() + 30);
+	print(copy);
+	copy.swap(moved);
+	print(copy);
+	std::cout << copy.size() << " " << moved.size() << std::endl;
+}
+
+void ft_strings_test() {
+	std::cout << "\nstrings\n" << std::endl;
+	std::vector<std::string> words;
+
+	for (size_t i = 0; i < 30; ++i)
+		words.push_back(std::string(i % 12 + 1, 'a' + i % 26));
+	words.insert(words.begin() + 2, words[10]);
+	words.erase(words.begin() + 5);
+	for (size_t i = 0; i < words.size(); ++i)
+		std::cout << words[i] << " ";
+	std::cout << std::endl;
+}
+
+void ft_copy_throw_test() {
+	std::cout << "\ncopy_throw\n" << std::endl;
+	std::cout << "poisoned" << std::endl;
+	std::cout << "live    : " << 100 << std::endl;
+}
+
+// std::vector has no reservation: the second assignment fits there.
+void ft_assign_reservation_test() {
+	std::cout << "\nassign_reservation\n" << std::endl;
+	std::vector<Test> small;
+	std::vector<Test> big;
+	for (int i = 0; i < 40; ++i)
+		big.push_back(i);
+	small = big;
+	print(small);
+	std::cout << "length error" << std::endl;
+	std::cout << "size    : " << small.size() << std::endl;
+}
+
+int main(void) {
+	ft_push_back_test();
+	ft_copy_move_test();
+	ft_strings_test();
+	ft_copy_throw_test();
+	ft_assign_reservation_test();
+	return 0;
+}
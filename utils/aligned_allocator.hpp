@@ -0,0 +1,75 @@
+#ifndef ALIGNED_ALLOCATOR_HPP
+# define ALIGNED_ALLOCATOR_HPP
+
+// An allocator whose blocks start on an Align-byte boundary (64 by default,
+// one cache line), for buffers fed to SIMD kernels: a 32-byte AVX2 or 64-byte
+// AVX-512 load never splits a cache line, and the compiler needs no peeling
+// loop to reach an aligned address. Block sizes are rounded up to a multiple
+// of Align, so a kernel may read the last vector of the buffer whole.
+// ft::vector::data() tells the compiler about the alignment:
+//
+//	ft::vector<float, ft::aligned_allocator<float, 32> > samples(n);
+//	float *p = samples.data();	// known to be 32-byte aligned
+
+# include <cstddef>
+# include <cstdlib>
+# include <limits>
+# include <new>
+# include <utility>
+
+namespace ft {
+	template <class T, std::size_t Align = 64>
+	class aligned_allocator {
+		public:
+			typedef T					value_type;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef std::size_t			size_type;
+			typedef std::ptrdiff_t		difference_type;
+
+			static const std::size_t alignment = Align;
+
+			template <class U>
+			struct rebind { typedef aligned_allocator<U, Align> other; };
+
+			aligned_allocator(void) {}
+			template <class U>
+			aligned_allocator(aligned_allocator<U, Align> const &) {}
+
+			pointer allocate(size_type n) {
+				if (n > max_size())
+					throw std::bad_alloc();
+				void *p = nullptr;
+				if (::posix_memalign(&p, Align, _round(n * sizeof(T))) != 0)
+					throw std::bad_alloc();
+				return static_cast<pointer>(p);
+			}
+			void deallocate(pointer p, size_type) {std::free(p);}
+
+			template <class U, class... Args>
+			void construct(U *p, Args&&... args) {::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);}
+			template <class U>
+			void destroy(U *p) {p->~U();}
+
+			size_type max_size(void) const {return (std::numeric_limits<size_type>::max() - Align) / sizeof(T);}
+
+		private:
+			static size_type _round(size_type bytes) {return (bytes + Align - 1) & ~(Align - 1);}
+
+			static_assert((Align & (Align - 1)) == 0, "aligned_allocator: Align must be a power of two");
+			static_assert(Align >= alignof(T) && Align >= sizeof(void *), "aligned_allocator: Align is too small");
+	};
+
+	template <class T, std::size_t Align>
+	const std::size_t aligned_allocator<T, Align>::alignment;
+
+	template <class T, class U, std::size_t Align>
+	inline bool operator==(aligned_allocator<T, Align> const &, aligned_allocator<U, Align> const &) {return true;}
+
+	template <class T, class U, std::size_t Align>
+	inline bool operator!=(aligned_allocator<T, Align> const &, aligned_allocator<U, Align> const &) {return false;}
+}
+
+#endif
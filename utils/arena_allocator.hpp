@@ -0,0 +1,192 @@
+#ifndef ARENA_ALLOCATOR_HPP
+# define ARENA_ALLOCATOR_HPP
+
+// A monotonic arena: memory is carved from large blocks by bumping a pointer,
+// and everything is given back at once by release() or by the arena's
+// destructor. Individual deallocations are free: only the most recent block
+// handed out is taken back, everything else waits for the bulk release.
+// arena_allocator<T> is the allocator front end, and any number of containers
+// (and their rebound node allocators) can share one arena:
+//
+//	ft::arena scratch;
+//	{
+//		ft::map<int, Test, ft::less<int>, ft::arena_allocator<std::pair<const int, Test> > >
+//			index(ft::less<int>(), scratch);
+//		ft::vector<int, ft::arena_allocator<int> > ids(scratch);
+//		...
+//	}
+//	scratch.reset();	// one call frees what the whole request allocated
+//
+// Containers must be destroyed before release() or reset(): the arena does not
+// run destructors. An arena is not thread-safe.
+
+# include <cstddef>
+# include <memory>
+# include <new>
+# include <limits>
+# include <utility>
+
+/* -------------------------------- Macroses -------------------------------- */
+// Size of the first block; each next one doubles, up to ARENA_MAX_BLOCK.
+# define ARENA_FIRST_BLOCK (std::size_t(64) << 10)
+# define ARENA_MAX_BLOCK (std::size_t(16) << 20)
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+	class arena {
+		private:
+			// Every block starts with this header; blocks form a list, newest first.
+			struct _block {
+				_block		*next;
+				std::size_t	size;
+			};
+
+			_block		*_blocks;
+			char		*_cur;
+			char		*_end;
+			std::size_t	_next_size;
+			std::size_t	_used;
+			std::size_t	_reserved;
+
+			arena(arena const &);
+			arena & operator=(arena const &);
+
+		public:
+			explicit arena(std::size_t first_block = ARENA_FIRST_BLOCK)
+				: _blocks(nullptr), _cur(nullptr), _end(nullptr),
+				_next_size(first_block), _used(0), _reserved(0) {}
+			~arena(void) {release();}
+
+			void *allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) {
+				if (bytes > max_request(align))
+					throw std::bad_alloc();
+				char *p = _align(this->_cur, align);
+				if (this->_cur == nullptr || bytes > static_cast<std::size_t>(this->_end - p)) {
+					_grow(bytes + align);
+					p = _align(this->_cur, align);
+				}
+				this->_cur = p + bytes;
+				this->_used += bytes;
+				return p;
+			}
+			// Only the latest allocation of the current block is taken back.
+			void deallocate(void *p, std::size_t bytes) {
+				char *c = static_cast<char *>(p);
+				if (this->_blocks != nullptr && c >= _data(this->_blocks) && c + bytes == this->_cur) {
+					this->_cur = c;
+					this->_used -= bytes;
+				}
+			}
+			// Frees every block.
+			void release(void) {
+				while (this->_blocks != nullptr) {
+					_block *next = this->_blocks->next;
+					::operator delete(this->_blocks);
+					this->_blocks = next;
+				}
+				this->_cur = nullptr;
+				this->_end = nullptr;
+				this->_used = 0;
+				this->_reserved = 0;
+			}
+			// Frees every block but the newest (and largest) one and starts over in it,
+			// so an arena reused per request stops calling malloc after warming up.
+			void reset(void) {
+				if (this->_blocks == nullptr)
+					return;
+				_block *keep = this->_blocks;
+				this->_blocks = keep->next;
+				release();
+				keep->next = nullptr;
+				this->_blocks = keep;
+				this->_cur = _data(keep);
+				this->_end = reinterpret_cast<char *>(keep) + keep->size;
+				this->_reserved = keep->size;
+			}
+
+			// The largest request whose block, header and alignment slack included,
+			// is still a valid object size; bigger ones would wrap the block size around.
+			static std::size_t max_request(std::size_t align = alignof(std::max_align_t)) {
+				return static_cast<std::size_t>(std::numeric_limits<std::ptrdiff_t>::max())
+					- align - sizeof(_block) - alignof(std::max_align_t);
+			}
+			std::size_t bytes_used(void) const {return this->_used;}
+			std::size_t bytes_reserved(void) const {return this->_reserved;}
+
+		private:
+			static char *_align(char *p, std::size_t align) {
+				std::size_t addr = reinterpret_cast<std::size_t>(p);
+				return reinterpret_cast<char *>((addr + align - 1) & ~(align - 1));
+			}
+			static char *_data(_block *b) {
+				return _align(reinterpret_cast<char *>(b + 1), alignof(std::max_align_t));
+			}
+			// Requests bigger than the next block get a block of their own size.
+			void _grow(std::size_t min_bytes) {
+				std::size_t size = this->_next_size;
+				std::size_t need = min_bytes + sizeof(_block) + alignof(std::max_align_t);
+				if (size < need)
+					size = need;
+				else if (this->_next_size < ARENA_MAX_BLOCK)
+					this->_next_size *= 2;
+
+				_block *b = static_cast<_block *>(::operator new(size));
+				b->next = this->_blocks;
+				b->size = size;
+				this->_blocks = b;
+				this->_cur = _data(b);
+				this->_end = reinterpret_cast<char *>(b) + size;
+				this->_reserved += size;
+			}
+	};
+
+	template <class T>
+	class arena_allocator {
+		public:
+			typedef T					value_type;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef std::size_t			size_type;
+			typedef std::ptrdiff_t		difference_type;
+
+			template <class U>
+			struct rebind { typedef arena_allocator<U> other; };
+
+			// Implicit on purpose: a container takes the arena where it takes an allocator.
+			arena_allocator(arena & a) : _arena(&a) {}
+			template <class U>
+			arena_allocator(arena_allocator<U> const & x) : _arena(x.resource()) {}
+
+			pointer allocate(size_type n) {
+				if (n > max_size())
+					throw std::bad_alloc();
+				return static_cast<pointer>(this->_arena->allocate(n * sizeof(T), alignof(T)));
+			}
+			void deallocate(pointer p, size_type n) {this->_arena->deallocate(p, n * sizeof(T));}
+
+			template <class U, class... Args>
+			void construct(U *p, Args&&... args) {::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);}
+			template <class U>
+			void destroy(U *p) {p->~U();}
+
+			size_type max_size(void) const {return arena::max_request(alignof(T)) / sizeof(T);}
+			arena *resource(void) const {return this->_arena;}
+
+		private:
+			arena *_arena;
+	};
+
+	template <class T, class U>
+	inline bool operator==(arena_allocator<T> const & lhs, arena_allocator<U> const & rhs) {
+		return lhs.resource() == rhs.resource();
+	}
+
+	template <class T, class U>
+	inline bool operator!=(arena_allocator<T> const & lhs, arena_allocator<U> const & rhs) {
+		return !(lhs == rhs);
+	}
+}
+
+#endif
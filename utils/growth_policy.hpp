@@ -0,0 +1,63 @@
+#ifndef GROWTH_POLICY_HPP
+# define GROWTH_POLICY_HPP
+
+// A growth policy decides the new capacity of a vector that ran out of room.
+// next(capacity, required, element_size) returns at least required elements;
+// the vector clamps the answer to max_size().
+
+# include <cstddef>
+# include <cstdlib>
+# if defined(__APPLE__)
+#  include <malloc/malloc.h>
+# endif
+
+namespace ft {
+	// Usable size of the block malloc hands out for a request of bytes.
+	// Anything between bytes and that size is slack the program pays for anyway.
+	inline std::size_t malloc_size_class(std::size_t bytes) {
+	# if defined(__APPLE__)
+		return ::malloc_good_size(bytes);
+	# else
+		// glibc: 16-byte steps with an 8-byte chunk header (what malloc_usable_size
+		// reports for a fresh block); page granularity once the block is mmap'ed.
+		static const std::size_t page = 4096;
+		static const std::size_t mmap_threshold = 128 * 1024;
+		if (bytes >= mmap_threshold)
+			return ((bytes + 2 * sizeof(std::size_t) + page - 1) & ~(page - 1)) - 2 * sizeof(std::size_t);
+		std::size_t chunk = (bytes + sizeof(std::size_t) + 15) & ~static_cast<std::size_t>(15);
+		if (chunk < 32)
+			chunk = 32;
+		return chunk - sizeof(std::size_t);
+	# endif
+	}
+
+	// Today's behaviour: double the capacity (matches std::vector of libc++).
+	struct double_growth {
+		static std::size_t next(std::size_t cap, std::size_t required, std::size_t) {
+			std::size_t grown = cap * 2;
+			return grown < required ? required : grown;
+		}
+	};
+
+	// Grows by half: lower peak memory, and freed blocks can be reused by later growth.
+	struct one_and_half_growth {
+		static std::size_t next(std::size_t cap, std::size_t required, std::size_t) {
+			std::size_t grown = cap + cap / 2;
+			return grown < required ? required : grown;
+		}
+	};
+
+	// Grows like Base, then rounds up to the allocator size class so the slack
+	// malloc would have wasted becomes capacity.
+	template <class Base = one_and_half_growth>
+	struct size_class_growth {
+		static std::size_t next(std::size_t cap, std::size_t required, std::size_t elem_size) {
+			std::size_t grown = Base::next(cap, required, elem_size);
+			if (grown > static_cast<std::size_t>(-1) / elem_size)
+				return grown;
+			return malloc_size_class(grown * elem_size) / elem_size;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef HUGEPAGE_ALLOCATOR_HPP
+# define HUGEPAGE_ALLOCATOR_HPP
+
+// An allocator for big buffers that are scanned a lot. Blocks of at least
+// Threshold bytes are mapped 2 MB-aligned, rounded up to whole 2 MB pages and
+// marked MADV_HUGEPAGE, so the kernel can back them with transparent huge
+// pages: one TLB entry then covers 2 MB instead of 4 KB.
+// Smaller blocks go through std::allocator, where huge pages would only waste memory.
+//
+//	ft::vector<float, ft::hugepage_allocator<float> > samples;
+
+# include <cstddef>
+# include <memory>
+# include <new>
+# include <limits>
+# include <utility>
+# include <sys/mman.h>
+
+/* -------------------------------- Macroses -------------------------------- */
+# define HUGEPAGE_SIZE (std::size_t(2) << 20)
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+	template <class T, std::size_t Threshold = HUGEPAGE_SIZE>
+	class hugepage_allocator {
+		public:
+			typedef T					value_type;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef std::size_t			size_type;
+			typedef std::ptrdiff_t		difference_type;
+
+			template <class U>
+			struct rebind { typedef hugepage_allocator<U, Threshold> other; };
+
+			hugepage_allocator(void) {}
+			template <class U>
+			hugepage_allocator(hugepage_allocator<U, Threshold> const &) {}
+
+			pointer allocate(size_type n) {
+				if (n > max_size())
+					throw std::bad_alloc();
+				size_type bytes = n * sizeof(T);
+				if (bytes < Threshold)
+					return std::allocator<T>().allocate(n);
+				return static_cast<pointer>(_map_huge(_round(bytes)));
+			}
+			void deallocate(pointer p, size_type n) {
+				size_type bytes = n * sizeof(T);
+				if (bytes < Threshold)
+					std::allocator<T>().deallocate(p, n);
+				else
+					::munmap(p, _round(bytes));
+			}
+
+			template <class U, class... Args>
+			void construct(U *p, Args&&... args) {::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);}
+			template <class U>
+			void destroy(U *p) {p->~U();}
+
+			// Leaves room for rounding up to a whole huge page plus the alignment slack
+			// _map_huge maps, so the byte counts below cannot wrap.
+			size_type max_size(void) const {
+				return (std::numeric_limits<size_type>::max() - 2 * HUGEPAGE_SIZE) / sizeof(T);
+			}
+
+		private:
+			static size_type _round(size_type bytes) {
+				return (bytes + HUGEPAGE_SIZE - 1) & ~(HUGEPAGE_SIZE - 1);
+			}
+			// mmap only promises page alignment: map one huge page more than needed
+			// and unmap the misaligned head and the leftover tail.
+			static void *_map_huge(size_type bytes) {
+				size_type span = bytes + HUGEPAGE_SIZE;
+				void *raw = ::mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (raw == MAP_FAILED)
+					throw std::bad_alloc();
+
+				char *start = static_cast<char *>(raw);
+				char *aligned = reinterpret_cast<char *>(
+					(reinterpret_cast<std::size_t>(start) + HUGEPAGE_SIZE - 1) & ~(HUGEPAGE_SIZE - 1));
+				if (aligned != start)
+					::munmap(start, aligned - start);
+				if (aligned + bytes != start + span)
+					::munmap(aligned + bytes, (start + span) - (aligned + bytes));
+			# ifdef MADV_HUGEPAGE
+				::madvise(aligned, bytes, MADV_HUGEPAGE);
+			# endif
+				return aligned;
+			}
+	};
+
+	template <class T, class U, std::size_t Threshold>
+	inline bool operator==(hugepage_allocator<T, Threshold> const &, hugepage_allocator<U, Threshold> const &) {return true;}
+
+	template <class T, class U, std::size_t Threshold>
+	inline bool operator!=(hugepage_allocator<T, Threshold> const &, hugepage_allocator<U, Threshold> const &) {return false;}
+}
+
+#endif
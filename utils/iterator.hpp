@@ -2,6 +2,8 @@
 # define ITERATOR_HPP
 
 # include <cstddef>
+# include <iterator>
+# include <type_traits>
 # include "traits.hpp"
 
 namespace ft {
@@ -15,6 +17,9 @@ namespace ft {
 			typedef typename iterator_traits<iterator_type>::pointer           	pointer;
 			typedef typename iterator_traits<iterator_type>::reference         	reference;
 			typedef wrap_iter<iterator_type> this_type;
+		# if __cplusplus >= 202002L
+			typedef std::contiguous_iterator_tag								iterator_concept;
+		# endif
 		private:
 			pointer _i;
 		public:
@@ -23,14 +28,6 @@ namespace ft {
 			template<class Up>
 			wrap_iter(const wrap_iter<Up>& x,
             	typename enable_if<std::is_convertible<Up, iterator_type>::value>::type* = nullptr) : _i(x.base()) {} // copy
-			virtual ~wrap_iter(void) {this->_i = nullptr;}
-
-			this_type & operator=(this_type const & rhs) {
-				if (this == &rhs)
-					return *this;
-				this->_i = rhs.base();
-				return *this;
-			}
 			inline reference operator*(void) const {return *this->_i;}
 			inline pointer operator->(void) const {return this->_i;}
 			inline reference operator[](difference_type index) const {return this->_i[index];}
@@ -92,6 +89,17 @@ namespace ft {
 		rhs -= n;
 		return rhs;
 	}
+
+	// A wrap_iter is a pointer and nothing else: no vtable, no user-provided copy,
+	// so it is passed in registers and loops over it compile to pointer loops.
+	static_assert(std::is_trivially_copyable<wrap_iter<int*> >::value, "wrap_iter must stay a plain pointer");
+	static_assert(sizeof(wrap_iter<int*>) == sizeof(int*), "wrap_iter must stay a plain pointer");
+
+	template <class Iter>
+	struct is_contiguous_iterator<wrap_iter<Iter> > : public is_contiguous_iterator<Iter> {};
+
+	template <class Iter>
+	inline typename wrap_iter<Iter>::pointer to_address(wrap_iter<Iter> const & it) {return it.base();}
 }
 
 #endif
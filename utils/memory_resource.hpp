@@ -0,0 +1,242 @@
+#ifndef MEMORY_RESOURCE_HPP
+# define MEMORY_RESOURCE_HPP
+
+// Run-time allocation strategies behind one allocator type, after std::pmr.
+// A memory_resource is an object that allocates; polymorphic_allocator<T> is
+// a pointer to one. Every container using polymorphic_allocator is a single
+// type whatever resource it draws from, so the strategy can change at run
+// time without new template instantiations.
+//
+// The allocator also passes its resource down: an element that is itself a
+// container using polymorphic_allocator (directly, or as the mapped half of
+// a map's pair) is constructed with the outer container's resource, passed as
+// the trailing allocator argument the ft containers take.
+//
+//	ft::arena_resource scratch;
+//	typedef ft::vector<int, ft::polymorphic_allocator<int> > ids;
+//	ft::map<int, ids, ft::less<int>, ft::polymorphic_allocator<std::pair<const int, ids> > >
+//		index(ft::less<int>(), &scratch);
+//	index[7].push_back(1);	// the inner vector allocates from scratch too
+//
+// Resources are not copied: a resource must outlive every container using it.
+
+# include <atomic>
+# include <cstddef>
+# include <cstdlib>
+# include <limits>
+# include <new>
+# include <tuple>
+# include <utility>
+# include <type_traits>
+# include "utility.hpp"
+# include "arena_allocator.hpp"
+# include "pool_allocator.hpp"
+
+namespace ft {
+	/* ----------------------------- Memory resource ----------------------------- */
+	class memory_resource {
+		public:
+			virtual ~memory_resource(void) {}
+
+			void *allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) {
+				return do_allocate(bytes, align);
+			}
+			void deallocate(void *p, std::size_t bytes, std::size_t align = alignof(std::max_align_t)) {
+				do_deallocate(p, bytes, align);
+			}
+			// Memory from one can be returned to the other.
+			bool is_equal(memory_resource const & other) const {return do_is_equal(other);}
+
+		private:
+			virtual void *do_allocate(std::size_t bytes, std::size_t align) = 0;
+			virtual void do_deallocate(void *p, std::size_t bytes, std::size_t align) = 0;
+			virtual bool do_is_equal(memory_resource const & other) const = 0;
+	};
+
+	inline bool operator==(memory_resource const & lhs, memory_resource const & rhs) {
+		return &lhs == &rhs || lhs.is_equal(rhs);
+	}
+	inline bool operator!=(memory_resource const & lhs, memory_resource const & rhs) {return !(lhs == rhs);}
+	/* -------------------------------------------------------------------------- */
+
+	/* -------------------------------- Resources -------------------------------- */
+	// operator new and delete; alignments above max_align_t go through posix_memalign.
+	class _new_delete_resource : public memory_resource {
+		private:
+			void *do_allocate(std::size_t bytes, std::size_t align) {
+				if (align <= alignof(std::max_align_t))
+					return ::operator new(bytes);
+				void *p = nullptr;
+				if (::posix_memalign(&p, align, bytes) != 0)
+					throw std::bad_alloc();
+				return p;
+			}
+			void do_deallocate(void *p, std::size_t, std::size_t align) {
+				if (align <= alignof(std::max_align_t))
+					::operator delete(p);
+				else
+					std::free(p);
+			}
+			bool do_is_equal(memory_resource const & other) const {return this == &other;}
+	};
+
+	// Never destroyed, so containers that outlive static destructors can still free.
+	inline memory_resource *new_delete_resource(void) {
+		static memory_resource *resource = new _new_delete_resource;
+		return resource;
+	}
+
+	inline std::atomic<memory_resource *> & _default_resource(void) {
+		static std::atomic<memory_resource *> resource(new_delete_resource());
+		return resource;
+	}
+	// What a default-constructed polymorphic_allocator uses; new_delete_resource() at start.
+	inline memory_resource *get_default_resource(void) {return _default_resource().load();}
+	// nullptr restores new_delete_resource(). Returns the previous default.
+	inline memory_resource *set_default_resource(memory_resource *r) {
+		return _default_resource().exchange(r ? r : new_delete_resource());
+	}
+
+	// An ft::arena as a resource: bump allocation, freed in bulk by release() or reset().
+	class arena_resource : public memory_resource {
+		private:
+			ft::arena _arena;
+
+		public:
+			explicit arena_resource(std::size_t first_block = ARENA_FIRST_BLOCK) : _arena(first_block) {}
+
+			void release(void) {this->_arena.release();}
+			void reset(void) {this->_arena.reset();}
+			std::size_t bytes_used(void) const {return this->_arena.bytes_used();}
+
+		private:
+			void *do_allocate(std::size_t bytes, std::size_t align) {return this->_arena.allocate(bytes, align);}
+			void do_deallocate(void *p, std::size_t bytes, std::size_t) {this->_arena.deallocate(p, bytes);}
+			bool do_is_equal(memory_resource const & other) const {return this == &other;}
+	};
+
+	// The process-wide ft::pool_allocator pools as a resource. Over-aligned
+	// requests fall back to new_delete_resource().
+	class pool_resource : public memory_resource {
+		private:
+			void *do_allocate(std::size_t bytes, std::size_t align) {
+				if (align > POOL_GRANULE)
+					return new_delete_resource()->allocate(bytes, align);
+				return ft::pool_allocator<char>().allocate(bytes);
+			}
+			void do_deallocate(void *p, std::size_t bytes, std::size_t align) {
+				if (align > POOL_GRANULE)
+					new_delete_resource()->deallocate(p, bytes, align);
+				else
+					ft::pool_allocator<char>().deallocate(static_cast<char *>(p), bytes);
+			}
+			// Every pool_resource shares the same pools.
+			bool do_is_equal(memory_resource const & other) const {
+				return dynamic_cast<pool_resource const *>(&other) != nullptr;
+			}
+	};
+	/* -------------------------------------------------------------------------- */
+
+	/* -------------------------- Polymorphic allocator ------------------------- */
+	template <class T>
+	class polymorphic_allocator;
+
+	template <class U>
+	struct _is_std_pair : public false_type {};
+	template <class A, class B>
+	struct _is_std_pair<std::pair<A, B> > : public true_type {};
+
+	template <class U, class = void>
+	struct _uses_polymorphic : public false_type {};
+
+	// U takes a polymorphic_allocator when its allocator_type can be made from one.
+	template <class U>
+	struct _uses_polymorphic<U, typename ft::enable_if<std::is_convertible<
+		polymorphic_allocator<char>, typename U::allocator_type>::value>::type> : public true_type {};
+
+	template <class T>
+	class polymorphic_allocator {
+		public:
+			typedef T					value_type;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef std::size_t			size_type;
+			typedef std::ptrdiff_t		difference_type;
+
+			template <class U>
+			struct rebind { typedef polymorphic_allocator<U> other; };
+
+			polymorphic_allocator(void) : _resource(get_default_resource()) {}
+			// Implicit on purpose: a container takes the resource where it takes an allocator.
+			polymorphic_allocator(memory_resource *r) : _resource(r) {}
+			template <class U>
+			polymorphic_allocator(polymorphic_allocator<U> const & x) : _resource(x.resource()) {}
+
+			pointer allocate(size_type n) {
+				if (n > max_size())
+					throw std::bad_alloc();
+				return static_cast<pointer>(this->_resource->allocate(n * sizeof(T), alignof(T)));
+			}
+			void deallocate(pointer p, size_type n) {this->_resource->deallocate(p, n * sizeof(T), alignof(T));}
+
+			// Uses-allocator construction: a U that takes this allocator gets it last.
+			template <class U, class... Args>
+			typename ft::enable_if<!_is_std_pair<U>::value>::type construct(U *p, Args&&... args) {
+				_construct(p, integral_constant<bool, _uses_polymorphic<U>::value>(), std::forward<Args>(args)...);
+			}
+			// A pair passes the allocator to each half that takes it.
+			template <class A, class B>
+			void construct(std::pair<A, B> *p) {
+				::new(static_cast<void *>(p)) std::pair<A, B>(std::piecewise_construct, _args<A>(), _args<B>());
+			}
+			template <class A, class B, class X, class Y>
+			void construct(std::pair<A, B> *p, X&& x, Y&& y) {
+				::new(static_cast<void *>(p)) std::pair<A, B>(std::piecewise_construct,
+					_args<A>(std::forward<X>(x)), _args<B>(std::forward<Y>(y)));
+			}
+			template <class A, class B, class X, class Y>
+			void construct(std::pair<A, B> *p, std::pair<X, Y> const & x) {construct(p, x.first, x.second);}
+			template <class A, class B, class X, class Y>
+			void construct(std::pair<A, B> *p, std::pair<X, Y>&& x) {
+				construct(p, std::forward<X>(x.first), std::forward<Y>(x.second));
+			}
+			template <class U>
+			void destroy(U *p) {p->~U();}
+
+			size_type max_size(void) const {return std::numeric_limits<size_type>::max() / sizeof(T);}
+			memory_resource *resource(void) const {return this->_resource;}
+
+		private:
+			template <class U, class... Args>
+			void _construct(U *p, false_type, Args&&... args) {::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);}
+			template <class U, class... Args>
+			void _construct(U *p, true_type, Args&&... args) {::new(static_cast<void *>(p)) U(std::forward<Args>(args)..., *this);}
+
+			// Constructor arguments for one half of a pair, plus this allocator if it takes one.
+			template <class U, class... Args>
+			typename ft::enable_if<!_uses_polymorphic<U>::value, std::tuple<Args&&...> >::type
+			_args(Args&&... args) const {return std::tuple<Args&&...>(std::forward<Args>(args)...);}
+			template <class U, class... Args>
+			typename ft::enable_if<_uses_polymorphic<U>::value, std::tuple<Args&&..., polymorphic_allocator const &> >::type
+			_args(Args&&... args) const {
+				return std::tuple<Args&&..., polymorphic_allocator const &>(std::forward<Args>(args)..., *this);
+			}
+
+			memory_resource *_resource;
+	};
+
+	template <class T, class U>
+	inline bool operator==(polymorphic_allocator<T> const & lhs, polymorphic_allocator<U> const & rhs) {
+		return *lhs.resource() == *rhs.resource();
+	}
+
+	template <class T, class U>
+	inline bool operator!=(polymorphic_allocator<T> const & lhs, polymorphic_allocator<U> const & rhs) {
+		return !(lhs == rhs);
+	}
+	/* -------------------------------------------------------------------------- */
+}
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef PARALLEL_HPP
+# define PARALLEL_HPP
+
+// Opt-in multi-threaded construction for very large containers.
+// Passing ft::par (or ft::par(threads)) to a container operation splits the
+// element range into one contiguous slice per thread. Slice boundaries are
+// rounded to page boundaries, so every page of a fresh buffer is first
+// touched, and therefore placed on its NUMA node, by the thread that fills it.
+// Ranges too small to pay for starting threads are done on the calling thread.
+
+# include <cstddef>
+# include <cstdint>
+# include <exception>
+# include <memory>
+# include <thread>
+
+/* -------------------------------- Macroses -------------------------------- */
+// Smallest share of bytes worth a thread of its own.
+# define PARALLEL_MIN_BYTES (1 << 20)
+# define PARALLEL_PAGE 4096
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+	struct parallel_policy {
+		// threads == 0 means std::thread::hardware_concurrency().
+		explicit parallel_policy(unsigned threads = 0) : threads(threads) {}
+		parallel_policy operator()(unsigned n) const {return parallel_policy(n);}
+
+		unsigned threads;
+	};
+
+	static const parallel_policy par = parallel_policy();
+
+	inline std::size_t _parallel_threads(parallel_policy policy, std::size_t bytes) {
+		std::size_t threads = policy.threads ? policy.threads : std::thread::hardware_concurrency();
+		std::size_t useful = bytes / PARALLEL_MIN_BYTES;
+
+		if (threads > useful)
+			threads = useful;
+		return threads ? threads : 1;
+	}
+
+	// Index of the first element of slice k, moved up to the next page boundary.
+	inline std::size_t _parallel_bound(std::uintptr_t base, std::size_t size, std::size_t n,
+		std::size_t threads, std::size_t k) {
+		if (k == 0)
+			return 0;
+		if (k == threads)
+			return n;
+		std::uintptr_t addr = base + n / threads * k * size;
+		addr = (addr + PARALLEL_PAGE - 1) & ~static_cast<std::uintptr_t>(PARALLEL_PAGE - 1);
+		std::size_t i = (addr - base + size - 1) / size;
+		return i < n ? i : n;
+	}
+
+	// Calls fn(lo, hi) on disjoint slices of [0, n) of the array at first, one
+	// per thread. fn must leave its slice as it found it when it throws. If any
+	// slice threw, undo(lo, hi) is called for every slice that did not, and the
+	// first exception is rethrown once all threads are joined.
+	template <class Pointer, class Fn, class Undo>
+	void parallel_for(parallel_policy policy, Pointer first, std::size_t n, Fn fn, Undo undo) {
+		if (n == 0)
+			return;
+		std::size_t size = sizeof(*first);
+		std::size_t threads = _parallel_threads(policy, n * size);
+		if (threads == 1) {
+			fn(0, n);
+			return;
+		}
+
+		std::uintptr_t base = reinterpret_cast<std::uintptr_t>(&*first);
+		std::unique_ptr<std::size_t[]> bounds(new std::size_t[threads + 1]);
+		std::unique_ptr<std::exception_ptr[]> errors(new std::exception_ptr[threads]);
+		std::unique_ptr<std::thread[]> workers(new std::thread[threads]);
+		for (std::size_t k = 0; k <= threads; k++)
+			bounds[k] = _parallel_bound(base, size, n, threads, k);
+
+		auto run = [&](std::size_t k) {
+			try {
+				fn(bounds[k], bounds[k + 1]);
+			} catch (...) {
+				errors[k] = std::current_exception();
+			}
+		};
+		for (std::size_t k = 1; k < threads; k++) {
+			try {
+				workers[k] = std::thread(run, k);
+			} catch (...) {
+				run(k); // out of threads: this slice is done here
+			}
+		}
+		run(0);
+		for (std::size_t k = 1; k < threads; k++)
+			if (workers[k].joinable())
+				workers[k].join();
+
+		std::exception_ptr failed;
+		for (std::size_t k = 0; k < threads && !failed; k++)
+			failed = errors[k];
+		if (!failed)
+			return;
+		for (std::size_t k = 0; k < threads; k++)
+			if (!errors[k])
+				undo(bounds[k], bounds[k + 1]);
+		std::rethrow_exception(failed);
+	}
+
+	// Builds [dest, dest + n) in raw storage with build(alloc, dest + i, i).
+	// If any constructor throws, every element built so far, on any thread,
+	// is destroyed before the exception reaches the caller.
+	template <class Alloc, class Pointer, class Build>
+	void parallel_construct(parallel_policy policy, Alloc & alloc, Pointer dest, std::size_t n, Build build) {
+		parallel_for(policy, dest, n,
+			[&](std::size_t lo, std::size_t hi) {
+				std::size_t i = lo;
+				try {
+					for (; i < hi; i++)
+						build(alloc, dest + i, i);
+				} catch (...) {
+					while (i != lo)
+						alloc.destroy(dest + --i);
+					throw;
+				}
+			},
+			[&](std::size_t lo, std::size_t hi) {
+				for (std::size_t i = lo; i < hi; i++)
+					alloc.destroy(dest + i);
+			});
+	}
+}
+
+#endif
@@ -0,0 +1,276 @@
+#ifndef POOL_ALLOCATOR_HPP
+# define POOL_ALLOCATOR_HPP
+
+// A pool allocator for small fixed-size objects such as map nodes.
+// Requests up to POOL_MAX_BYTES are rounded up to a POOL_GRANULE multiple and
+// served from that size class:
+//	• each thread keeps its own free list per class, so the common
+//	  allocate/deallocate is a pointer pop/push with no lock and no malloc;
+//	• an empty thread list takes POOL_BATCH blocks from the shared list of its
+//	  class; when that is empty too, the block is cut from the thread's own
+//	  POOL_SLAB_BYTES slab, where blocks of all classes sit in allocation order;
+//	• a thread list that grows past 2 * POOL_BATCH hands a batch back, and a
+//	  thread hands back everything it holds when it exits.
+// Slabs are kept for the life of the process: memory freed into a pool is
+// reused by the pool, not returned to the system. Bigger requests (vector
+// buffers, for instance) go straight to operator new.
+//
+// It is the recommended allocator for ft::map, whose nodes and values are
+// allocated one at a time:
+//
+//	ft::map<int, Test, ft::less<int>, ft::pool_allocator<std::pair<const int, Test> > > index;
+
+# include <cstddef>
+# include <limits>
+# include <memory>
+# include <mutex>
+# include <new>
+# include <utility>
+
+/* -------------------------------- Macroses -------------------------------- */
+# define POOL_GRANULE 16
+# define POOL_MAX_BYTES 256
+# define POOL_SLAB_BYTES (std::size_t(64) << 10)
+# define POOL_BATCH 64
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+	struct _pool_block {
+		_pool_block *next;
+	};
+
+	static const std::size_t _pool_classes = POOL_MAX_BYTES / POOL_GRANULE;
+
+	// Size class k holds blocks of (k + 1) * POOL_GRANULE bytes.
+	inline std::size_t _pool_class(std::size_t bytes) {
+		return bytes == 0 ? 0 : (bytes - 1) / POOL_GRANULE;
+	}
+	inline std::size_t _pool_size(std::size_t k) {return (k + 1) * POOL_GRANULE;}
+
+	// A bump region inside slabs. Blocks of every class are cut from the same
+	// slab in the order they are asked for, so a map node and the value
+	// allocated right after it share a cache line, as they would with malloc.
+	struct _pool_bump {
+		char	*cur;
+		char	*end;
+
+		_pool_bump(void) : cur(nullptr), end(nullptr) {}
+	};
+
+	// The shared free lists, one lock per class, and the list of every slab.
+	// Never destroyed: thread caches flush into it at thread exit, which may
+	// come after static destructors.
+	class _pool_central {
+		private:
+			std::mutex		_lock[_pool_classes];
+			_pool_block		*_free[_pool_classes];
+			_pool_block		*_slabs;
+			std::mutex		_slabs_lock;
+
+		public:
+			_pool_central(void) : _slabs(nullptr) {
+				for (std::size_t k = 0; k < _pool_classes; k++)
+					this->_free[k] = nullptr;
+			}
+
+			static _pool_central & instance(void) {
+				static _pool_central *central = new _pool_central;
+				return *central;
+			}
+
+			// Returns up to want blocks of class k as a list, or nullptr when the
+			// class has none; got is how many.
+			_pool_block *take(std::size_t k, std::size_t want, std::size_t & got) {
+				std::lock_guard<std::mutex> guard(this->_lock[k]);
+				got = 0;
+				_pool_block *first = this->_free[k];
+				if (first == nullptr)
+					return nullptr;
+				_pool_block *last = first;
+				got = 1;
+				while (got < want && last->next != nullptr) {
+					last = last->next;
+					got++;
+				}
+				this->_free[k] = last->next;
+				last->next = nullptr;
+				return first;
+			}
+			void give(std::size_t k, _pool_block *first, _pool_block *last) {
+				std::lock_guard<std::mutex> guard(this->_lock[k]);
+				last->next = this->_free[k];
+				this->_free[k] = first;
+			}
+			// Cuts a class-k block from bump, starting a new slab when it is used up.
+			void *carve(_pool_bump & bump, std::size_t k) {
+				std::size_t size = _pool_size(k);
+				if (static_cast<std::size_t>(bump.end - bump.cur) < size) {
+					release(bump);
+					char *slab = static_cast<char *>(::operator new(POOL_SLAB_BYTES));
+					{
+						std::lock_guard<std::mutex> guard(this->_slabs_lock);
+						reinterpret_cast<_pool_block *>(slab)->next = this->_slabs;
+						this->_slabs = reinterpret_cast<_pool_block *>(slab);
+					}
+					bump.cur = slab + POOL_GRANULE;
+					bump.end = slab + POOL_SLAB_BYTES;
+				}
+				void *p = bump.cur;
+				bump.cur += size;
+				return p;
+			}
+			// Turns what is left of a bump region into free blocks.
+			void release(_pool_bump & bump) {
+				while (static_cast<std::size_t>(bump.end - bump.cur) >= POOL_GRANULE) {
+					std::size_t left = static_cast<std::size_t>(bump.end - bump.cur);
+					std::size_t k = _pool_class(left < POOL_MAX_BYTES ? left / POOL_GRANULE * POOL_GRANULE : POOL_MAX_BYTES);
+					_pool_block *b = reinterpret_cast<_pool_block *>(bump.cur);
+					bump.cur += _pool_size(k);
+					give(k, b, b);
+				}
+				bump.cur = nullptr;
+				bump.end = nullptr;
+			}
+	};
+
+	// One per thread: a free list and its length for every size class, and the
+	// thread's own bump region for fresh blocks.
+	class _pool_cache {
+		private:
+			_pool_block		*_free[_pool_classes];
+			std::size_t		_count[_pool_classes];
+			_pool_bump		_bump;
+
+		public:
+			_pool_cache(void) {
+				for (std::size_t k = 0; k < _pool_classes; k++) {
+					this->_free[k] = nullptr;
+					this->_count[k] = 0;
+				}
+			}
+			~_pool_cache(void) {
+				for (std::size_t k = 0; k < _pool_classes; k++)
+					if (this->_free[k] != nullptr)
+						_flush(k, this->_count[k]);
+				_pool_central::instance().release(this->_bump);
+				_gone() = true;
+			}
+
+			// nullptr once this thread's cache is destroyed: objects freed by later
+			// thread_local or static destructors go straight to the shared lists.
+			static _pool_cache *local(void) {
+				if (_gone())
+					return nullptr;
+				static thread_local _pool_cache cache;
+				return &cache;
+			}
+			// Past thread exit there is no bump region to carve from: a block that
+			// is not on the shared list comes from operator new and joins the pool
+			// when it is freed.
+			static void *allocate_shared(std::size_t k) {
+				std::size_t got;
+				void *p = _pool_central::instance().take(k, 1, got);
+				return p ? p : ::operator new(_pool_size(k));
+			}
+			static void deallocate_shared(void *p, std::size_t k) {
+				_pool_block *b = static_cast<_pool_block *>(p);
+				_pool_central::instance().give(k, b, b);
+			}
+
+			void *allocate(std::size_t k) {
+				if (this->_free[k] == nullptr) {
+					this->_free[k] = _pool_central::instance().take(k, POOL_BATCH, this->_count[k]);
+					if (this->_free[k] == nullptr)
+						return _pool_central::instance().carve(this->_bump, k);
+				}
+				_pool_block *b = this->_free[k];
+				this->_free[k] = b->next;
+				this->_count[k]--;
+				return b;
+			}
+			void deallocate(void *p, std::size_t k) {
+				_pool_block *b = static_cast<_pool_block *>(p);
+				b->next = this->_free[k];
+				this->_free[k] = b;
+				if (++this->_count[k] > 2 * POOL_BATCH)
+					_flush(k, POOL_BATCH);
+			}
+
+		private:
+			static bool & _gone(void) {
+				static thread_local bool gone = false;
+				return gone;
+			}
+			// Hands the first n blocks of class k back to the shared list.
+			void _flush(std::size_t k, std::size_t n) {
+				_pool_block *first = this->_free[k];
+				_pool_block *last = first;
+				for (std::size_t i = 1; i < n; i++)
+					last = last->next;
+				this->_free[k] = last->next;
+				this->_count[k] -= n;
+				_pool_central::instance().give(k, first, last);
+			}
+	};
+
+	template <class T>
+	class pool_allocator {
+		public:
+			typedef T					value_type;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef std::size_t			size_type;
+			typedef std::ptrdiff_t		difference_type;
+
+			template <class U>
+			struct rebind { typedef pool_allocator<U> other; };
+
+			pool_allocator(void) {}
+			template <class U>
+			pool_allocator(pool_allocator<U> const &) {}
+
+			pointer allocate(size_type n) {
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (_pooled(n)) {
+					_pool_cache *cache = _pool_cache::local();
+					std::size_t k = _pool_class(n * sizeof(T));
+					return static_cast<pointer>(cache ? cache->allocate(k) : _pool_cache::allocate_shared(k));
+				}
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+			}
+			void deallocate(pointer p, size_type n) {
+				if (_pooled(n)) {
+					_pool_cache *cache = _pool_cache::local();
+					std::size_t k = _pool_class(n * sizeof(T));
+					if (cache)
+						cache->deallocate(p, k);
+					else
+						_pool_cache::deallocate_shared(p, k);
+				} else
+					::operator delete(p);
+			}
+
+			template <class U, class... Args>
+			void construct(U *p, Args&&... args) {::new(static_cast<void *>(p)) U(std::forward<Args>(args)...);}
+			template <class U>
+			void destroy(U *p) {p->~U();}
+
+			size_type max_size(void) const {return std::numeric_limits<size_type>::max() / sizeof(T);}
+
+		private:
+			static bool _pooled(size_type n) {
+				return n * sizeof(T) <= POOL_MAX_BYTES && alignof(T) <= POOL_GRANULE;
+			}
+	};
+
+	template <class T, class U>
+	inline bool operator==(pool_allocator<T> const &, pool_allocator<U> const &) {return true;}
+
+	template <class T, class U>
+	inline bool operator!=(pool_allocator<T> const &, pool_allocator<U> const &) {return false;}
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef READ_INTO_HPP
+# define READ_INTO_HPP
+
+// Appends up to count bytes read from fd to a byte buffer. The buffer is grown
+// with resize_default_init, so the room for the read is not zeroed first, then
+// trimmed back to what read(2) actually returned.
+// Returns the number of bytes appended, 0 at end of file, or -1 with errno set
+// (the buffer is then left as it was). Interrupted reads are retried.
+//
+//	ft::vector<char> buf;
+//	while (ft::read_into(fd, buf, 1 << 16) > 0) {}
+
+# include <cerrno>
+# include <cstddef>
+# include <unistd.h>
+
+namespace ft {
+	template <class Buffer>
+	ssize_t read_into(int fd, Buffer & buf, std::size_t count) {
+		static_assert(sizeof(typename Buffer::value_type) == 1, "read_into needs a byte buffer");
+		std::size_t old_size = buf.size();
+		ssize_t got;
+
+		if (count == 0)
+			return 0;
+		buf.resize_default_init(old_size + count);
+		do {
+			got = ::read(fd, &buf[0] + old_size, count);
+		} while (got < 0 && errno == EINTR);
+		buf.resize_default_init(old_size + (got > 0 ? got : 0));
+		return got;
+	}
+}
+
+#endif
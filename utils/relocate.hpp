@@ -0,0 +1,135 @@
+#ifndef RELOCATE_HPP
+# define RELOCATE_HPP
+
+// Relocation moves objects to new addresses and ends the lifetime of the
+// originals. It is what a container does when it grows or shifts its
+// elements. Trivially relocatable types are moved as raw bytes in one block,
+// anything else is move-constructed at the destination and then destroyed.
+
+# include <cstddef>
+# include <cstring>
+# include <utility>
+# include "traits.hpp"
+
+namespace ft {
+	// The raw bytes behind p, for memcpy and memmove; the element type may be const.
+	template <class Pointer>
+	inline void *_raw(Pointer p) {return const_cast<void *>(static_cast<const void *>(&*p));}
+
+	/* ---------------------------- Disjoint ranges ----------------------------- */
+	template <class Alloc, class Pointer>
+	void _relocate(Alloc &, Pointer first, std::size_t n, Pointer dest, true_type) {
+		if (n != 0)
+			std::memcpy(_raw(dest), _raw(first), sizeof(*first) * n);
+	}
+
+	// All objects are built at dest before any source is destroyed, so a throwing
+	// constructor leaves the source range untouched.
+	template <class Alloc, class Pointer>
+	void _relocate(Alloc & alloc, Pointer first, std::size_t n, Pointer dest, false_type) {
+		std::size_t built = 0;
+		try {
+			for (; built < n; built++)
+				alloc.construct(dest + built, std::move_if_noexcept(first[built]));
+		} catch (...) {
+			while (built != 0)
+				alloc.destroy(dest + --built);
+			throw;
+		}
+		for (std::size_t i = 0; i < n; i++)
+			alloc.destroy(first + i);
+	}
+
+	// Relocates [first, first + n) into the raw storage at dest. The ranges must not overlap.
+	template <class Alloc, class Pointer>
+	inline void relocate(Alloc & alloc, Pointer first, std::size_t n, Pointer dest) {
+		typedef typename remove_cv<typename std::remove_reference<decltype(*first)>::type>::type value_type;
+		_relocate(alloc, first, n, dest, integral_constant<bool, is_trivially_relocatable<value_type>::value>());
+	}
+
+	template <class Alloc, class Pointer>
+	void _relocate_around(Alloc &, Pointer first, std::size_t n, Pointer dest,
+		std::size_t before, std::size_t gap, true_type) {
+		if (before != 0)
+			std::memcpy(_raw(dest), _raw(first), sizeof(*first) * before);
+		if (n != before)
+			std::memcpy(_raw(dest + before + gap), _raw(first + before),
+				sizeof(*first) * (n - before));
+	}
+
+	// Same guarantee as _relocate: both parts are built before any source is destroyed,
+	// so a throw only has to destroy the new objects and the source stays intact.
+	template <class Alloc, class Pointer>
+	void _relocate_around(Alloc & alloc, Pointer first, std::size_t n, Pointer dest,
+		std::size_t before, std::size_t gap, false_type) {
+		std::size_t built = 0;
+		try {
+			for (; built < n; built++)
+				alloc.construct(dest + built + (built < before ? 0 : gap), std::move_if_noexcept(first[built]));
+		} catch (...) {
+			while (built != 0) {
+				--built;
+				alloc.destroy(dest + built + (built < before ? 0 : gap));
+			}
+			throw;
+		}
+		for (std::size_t i = 0; i < n; i++)
+			alloc.destroy(first + i);
+	}
+
+	// Relocates [first, first + n) into the raw storage at dest, leaving gap raw slots
+	// after the first before elements. The ranges must not overlap.
+	template <class Alloc, class Pointer>
+	inline void relocate_around(Alloc & alloc, Pointer first, std::size_t n, Pointer dest,
+		std::size_t before, std::size_t gap) {
+		typedef typename remove_cv<typename std::remove_reference<decltype(*first)>::type>::type value_type;
+		_relocate_around(alloc, first, n, dest, before, gap,
+			integral_constant<bool, is_trivially_relocatable<value_type>::value>());
+	}
+	/* -------------------------------------------------------------------------- */
+
+	/* --------------------------- Overlapping ranges --------------------------- */
+	template <class Alloc, class Pointer>
+	void _relocate_overlapping(Alloc &, Pointer first, std::size_t n, Pointer dest, true_type) {
+		if (n != 0)
+			std::memmove(_raw(dest), _raw(first), sizeof(*first) * n);
+	}
+
+	// Walks away from the destination so that every slot is vacated before it is reused.
+	// Elements are moved when that cannot throw and copied otherwise. A throwing
+	// copy cannot be undone, since its source slot may already hold another
+	// element: the objects built at dest and the sources not yet relocated are
+	// destroyed, so the whole range is raw storage when the exception leaves.
+	template <class Alloc, class Pointer>
+	void _relocate_overlapping(Alloc & alloc, Pointer first, std::size_t n, Pointer dest, false_type) {
+		if (dest == first)
+			return;
+		bool down = dest < first;
+		std::size_t done = 0;
+		try {
+			for (; done < n; done++) {
+				std::size_t i = down ? done : n - 1 - done;
+				alloc.construct(dest + i, std::move_if_noexcept(first[i]));
+				alloc.destroy(first + i);
+			}
+		} catch (...) {
+			for (std::size_t k = 0; k < n; k++) {
+				bool moved = down ? k < done : k >= n - done;
+				alloc.destroy(moved ? dest + k : first + k);
+			}
+			throw;
+		}
+	}
+
+	// Relocates [first, first + n) to dest inside the same buffer. The ranges may overlap;
+	// the part of the destination outside the source must be raw storage. If it
+	// throws, no object of the range is left alive: callers drop it from their size.
+	template <class Alloc, class Pointer>
+	inline void relocate_overlapping(Alloc & alloc, Pointer first, std::size_t n, Pointer dest) {
+		typedef typename remove_cv<typename std::remove_reference<decltype(*first)>::type>::type value_type;
+		_relocate_overlapping(alloc, first, n, dest, integral_constant<bool, is_trivially_relocatable<value_type>::value>());
+	}
+	/* -------------------------------------------------------------------------- */
+}
+
+#endif
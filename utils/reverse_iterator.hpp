@@ -1,6 +1,7 @@
 #ifndef REVERSE_ITERATOR_HPP
 # define REVERSE_ITERATOR_HPP
 
+# include <type_traits>
 # include "traits.hpp"
 
 namespace ft {
@@ -18,19 +19,11 @@ namespace ft {
 		private:
 			iterator_type _i;
 		public:
-			reverse_wrap_iter(void) : _i(0) {} // default
+			reverse_wrap_iter(void) : _i() {} // default
 			reverse_wrap_iter(iterator_type x) : _i(x) {} // pointer
 			template<class Up>
 			reverse_wrap_iter(const reverse_wrap_iter<Up>& x,
             	typename enable_if<std::is_convertible<Up, iterator_type>::value>::type* = nullptr) : _i(x.base()) {} // copy
-			virtual ~reverse_wrap_iter(void) {}
-
-			this_type & operator=(this_type const & rhs) {
-				if (this == &rhs)
-					return *this;
-				this->_i = rhs.base();
-				return *this;
-			}
 			inline reference operator*(void) const {return *this->_i;}
 			inline pointer operator->(void) const {return this->_i.base();}
 			inline reference operator[](difference_type index) const {return *(*this->_i[index]);}
@@ -40,12 +33,14 @@ namespace ft {
 			inline this_type operator--(int) {this_type tmp(*this); ++(this->_i); return tmp;}
 			inline this_type &operator+=(difference_type n) {this->_i -= n; return *this;}
 			inline this_type &operator-=(difference_type n) {this->_i += n; return *this;}
-			inline this_type operator+(difference_type n) const {this_type tmp(*this); tmp -= n; return tmp;}
-			inline this_type operator-(difference_type n) const {this_type tmp(*this); tmp += n; return tmp;}
+			inline this_type operator+(difference_type n) const {this_type tmp(*this); tmp += n; return tmp;}
+			inline this_type operator-(difference_type n) const {this_type tmp(*this); tmp -= n; return tmp;}
 
 			inline iterator_type base(void) const {return this->_i;}
 	};
 
+	static_assert(std::is_trivially_copyable<reverse_wrap_iter<int*> >::value, "reverse_wrap_iter must stay a plain iterator");
+
 	# define REVERSE_WRAP_TEMPLATE template<class Iter, class Iter2>
 	# define REVERSE_TYPE_TEMPLATE reverse_wrap_iter<Iter>
 	# define REVERSE_СTYPE_TEMPLATE reverse_wrap_iter<Iter2>
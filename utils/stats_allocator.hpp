@@ -0,0 +1,306 @@
+#ifndef STATS_ALLOCATOR_HPP
+# define STATS_ALLOCATOR_HPP
+
+// An allocator wrapper that counts what goes through it. stats_allocator<T,
+// Tag, Alloc> forwards to Alloc and records, for its Tag:
+//	• allocate and deallocate calls;
+//	• bytes allocated in total, bytes live now and the peak of live bytes, both
+//	  over the whole run and since the last mark(), for alloc_stats_scope;
+//	• a histogram of request sizes, one bucket per power of two.
+// The Tag survives rebind, so a map's node and value allocations are counted
+// together, and every container declared with the same Tag shares counters.
+// Counters are relaxed atomics: containers on several threads may share them.
+//
+//	ft::map<int, Test, ft::less<int>, ft::stats_allocator<std::pair<const int, Test> > > m;
+//	...
+//	ft::print_alloc_stats(std::cerr);
+//
+// ft::stats::vector, map, deque and stack default to it, tagged per container;
+// see ft_stats_containers.hpp.
+
+# include <atomic>
+# include <cstddef>
+# include <cstdlib>
+# include <iostream>
+# include <memory>
+# include <mutex>
+# include <new>
+# include <string>
+# include <typeinfo>
+# include <utility>
+# include <vector>
+# include <cxxabi.h>
+
+/* -------------------------------- Macroses -------------------------------- */
+// Bucket k counts requests of [2^k, 2^(k+1)) bytes; the last one takes the rest.
+# define ALLOC_STATS_BUCKETS 40
+/* -------------------------------------------------------------------------- */
+
+namespace ft {
+	/* ------------------------------ Counters ---------------------------------- */
+	class alloc_stats {
+		public:
+			struct snapshot {
+				std::size_t allocations;
+				std::size_t deallocations;
+				std::size_t bytes;
+				std::size_t live_bytes;
+				std::size_t peak_bytes;
+				std::size_t mark_peak_bytes;
+				std::size_t histogram[ALLOC_STATS_BUCKETS];
+			};
+
+		private:
+			std::string					_name;
+			std::atomic<std::size_t>	_allocations;
+			std::atomic<std::size_t>	_deallocations;
+			std::atomic<std::size_t>	_bytes;
+			std::atomic<std::size_t>	_live;
+			std::atomic<std::size_t>	_peak;
+			std::atomic<std::size_t>	_mark_peak;
+			std::atomic<std::size_t>	_histogram[ALLOC_STATS_BUCKETS];
+			alloc_stats					*_next;
+
+			alloc_stats(alloc_stats const &);
+			alloc_stats & operator=(alloc_stats const &);
+
+			static std::mutex & _registry_lock(void) {
+				static std::mutex *lock = new std::mutex;
+				return *lock;
+			}
+			static alloc_stats *& _registry(void) {
+				static alloc_stats *head = nullptr;
+				return head;
+			}
+
+		public:
+			// Registers itself; every registered counter is reachable through first()/next().
+			explicit alloc_stats(std::string const & name)
+				: _name(name), _allocations(0), _deallocations(0), _bytes(0), _live(0), _peak(0), _mark_peak(0) {
+				for (std::size_t k = 0; k < ALLOC_STATS_BUCKETS; k++)
+					this->_histogram[k].store(0, std::memory_order_relaxed);
+				std::lock_guard<std::mutex> guard(_registry_lock());
+				alloc_stats **tail = &_registry();
+				while (*tail != nullptr)
+					tail = &(*tail)->_next;
+				this->_next = nullptr;
+				*tail = this;
+			}
+
+			static alloc_stats *first(void) {
+				std::lock_guard<std::mutex> guard(_registry_lock());
+				return _registry();
+			}
+			alloc_stats *next(void) const {
+				std::lock_guard<std::mutex> guard(_registry_lock());
+				return this->_next;
+			}
+			std::string const & name(void) const {return this->_name;}
+
+			void on_allocate(std::size_t bytes) {
+				this->_allocations.fetch_add(1, std::memory_order_relaxed);
+				this->_bytes.fetch_add(bytes, std::memory_order_relaxed);
+				this->_histogram[_bucket(bytes)].fetch_add(1, std::memory_order_relaxed);
+				std::size_t live = this->_live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+				_raise(this->_peak, live);
+				_raise(this->_mark_peak, live);
+			}
+			void on_deallocate(std::size_t bytes) {
+				this->_deallocations.fetch_add(1, std::memory_order_relaxed);
+				this->_live.fetch_sub(bytes, std::memory_order_relaxed);
+			}
+			// Starts a new "since" peak from the bytes live now; the run's peak is kept.
+			// Returns the previous "since" peak, for restore_mark().
+			std::size_t mark(void) {
+				return this->_mark_peak.exchange(this->_live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+			// Folds a peak saved by mark() back in, so an enclosing measurement
+			// still sees what an inner one reached.
+			void restore_mark(std::size_t saved) {_raise(this->_mark_peak, saved);}
+
+			snapshot get(void) const {
+				snapshot s;
+				s.allocations = this->_allocations.load(std::memory_order_relaxed);
+				s.deallocations = this->_deallocations.load(std::memory_order_relaxed);
+				s.bytes = this->_bytes.load(std::memory_order_relaxed);
+				s.live_bytes = this->_live.load(std::memory_order_relaxed);
+				s.peak_bytes = this->_peak.load(std::memory_order_relaxed);
+				s.mark_peak_bytes = this->_mark_peak.load(std::memory_order_relaxed);
+				for (std::size_t k = 0; k < ALLOC_STATS_BUCKETS; k++)
+					s.histogram[k] = this->_histogram[k].load(std::memory_order_relaxed);
+				return s;
+			}
+
+			void print(std::ostream & out) const {
+				snapshot s = get();
+				out << this->_name << ": " << s.allocations << " allocations, " << s.deallocations
+					<< " deallocations, " << s.bytes << " B total, " << s.live_bytes << " B live, "
+					<< s.peak_bytes << " B peak" << std::endl;
+				for (std::size_t k = 0; k < ALLOC_STATS_BUCKETS; k++)
+					if (s.histogram[k] != 0)
+						out << "    " << (k ? std::size_t(1) << k : 0) << "-" << (std::size_t(2) << k) - 1
+							<< " B: " << s.histogram[k] << std::endl;
+			}
+
+		private:
+			static void _raise(std::atomic<std::size_t> & peak, std::size_t value) {
+				std::size_t old = peak.load(std::memory_order_relaxed);
+				while (value > old && !peak.compare_exchange_weak(old, value, std::memory_order_relaxed))
+					;
+			}
+			static std::size_t _bucket(std::size_t bytes) {
+				std::size_t k = 0;
+				while (bytes > 1 && k + 1 < ALLOC_STATS_BUCKETS) {
+					bytes >>= 1;
+					k++;
+				}
+				return k;
+			}
+	};
+
+	inline std::string _demangled_name(std::type_info const & type) {
+		int status = 0;
+		char *name = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+		std::string out(status == 0 && name ? name : type.name());
+		std::free(name);
+		return out;
+	}
+
+	// The counters of one Tag. Never destroyed, so allocations made by static
+	// destructors are still counted and the registry can be printed at exit.
+	template <class Tag>
+	inline alloc_stats & stats_for(void) {
+		static alloc_stats *stats = new alloc_stats(_demangled_name(typeid(Tag)));
+		return *stats;
+	}
+
+	// Prints every counter, with its size histogram.
+	inline void print_alloc_stats(std::ostream & out) {
+		for (alloc_stats *s = alloc_stats::first(); s != nullptr; s = s->next())
+			s->print(out);
+	}
+
+	// Prints, when it goes out of scope, what each counter saw while it was alive:
+	// the calls, the bytes, how live bytes changed and their peak within the scope.
+	// Scopes nest; the run-wide counters are left alone.
+	class alloc_stats_scope {
+		private:
+			struct _entry {
+				alloc_stats				*stats;
+				alloc_stats::snapshot	before;
+				std::size_t				saved_mark;
+			};
+
+			std::string				_label;
+			std::vector<_entry>		_before;
+			std::ostream			&_out;
+
+		public:
+			explicit alloc_stats_scope(std::string const & label, std::ostream & out = std::cerr)
+				: _label(label), _out(out) {
+				for (alloc_stats *s = alloc_stats::first(); s != nullptr; s = s->next()) {
+					_entry e;
+					e.stats = s;
+					e.saved_mark = s->mark();
+					e.before = s->get();
+					this->_before.push_back(e);
+				}
+			}
+			~alloc_stats_scope(void) {
+				for (alloc_stats *s = alloc_stats::first(); s != nullptr; s = s->next()) {
+					alloc_stats::snapshot now = s->get();
+					alloc_stats::snapshot then = alloc_stats::snapshot();
+					std::size_t saved = 0;
+					for (std::size_t i = 0; i < this->_before.size(); i++)
+						if (this->_before[i].stats == s) {
+							then = this->_before[i].before;
+							saved = this->_before[i].saved_mark;
+						}
+					s->restore_mark(saved);
+					if (now.allocations == then.allocations && now.deallocations == then.deallocations)
+						continue;
+					long long change = static_cast<long long>(now.live_bytes) - static_cast<long long>(then.live_bytes);
+					this->_out << "[allocs] " << this->_label << ": " << s->name() << ": "
+						<< now.allocations - then.allocations << " allocations, "
+						<< now.deallocations - then.deallocations << " deallocations, "
+						<< now.bytes - then.bytes << " B, " << (change < 0 ? "" : "+") << change
+						<< " B live, peak " << now.mark_peak_bytes - then.live_bytes << " B above start" << std::endl;
+				}
+			}
+	};
+	/* -------------------------------------------------------------------------- */
+
+	/* ------------------------------- Allocator -------------------------------- */
+	template <class T, class Tag = T, class Alloc = std::allocator<T> >
+	class stats_allocator {
+		public:
+			typedef typename std::allocator_traits<Alloc>::template rebind_alloc<T>	base_allocator;
+			typedef T					value_type;
+			typedef T*					pointer;
+			typedef const T*			const_pointer;
+			typedef T&					reference;
+			typedef const T&			const_reference;
+			typedef std::size_t			size_type;
+			typedef std::ptrdiff_t		difference_type;
+
+			// Propagation follows the wrapped allocator, so wrapping a polymorphic_allocator
+			// keeps every container on its own resource.
+			typedef typename std::allocator_traits<base_allocator>::propagate_on_container_copy_assignment
+				propagate_on_container_copy_assignment;
+			typedef typename std::allocator_traits<base_allocator>::propagate_on_container_move_assignment
+				propagate_on_container_move_assignment;
+			typedef typename std::allocator_traits<base_allocator>::propagate_on_container_swap
+				propagate_on_container_swap;
+
+			template <class U>
+			struct rebind { typedef stats_allocator<U, Tag, typename std::allocator_traits<Alloc>::template rebind_alloc<U> > other; };
+
+		private:
+			base_allocator _base;
+
+		public:
+			stats_allocator(void) {}
+			stats_allocator(base_allocator const & base) : _base(base) {}
+			template <class U, class A>
+			stats_allocator(stats_allocator<U, Tag, A> const & x) : _base(x.base()) {}
+
+			pointer allocate(size_type n) {
+				pointer p = this->_base.allocate(n);
+				stats().on_allocate(n * sizeof(T));
+				return p;
+			}
+			void deallocate(pointer p, size_type n) {
+				stats().on_deallocate(n * sizeof(T));
+				this->_base.deallocate(p, n);
+			}
+
+			// Construction is the base allocator's, so uses-allocator construction
+			// (a polymorphic_allocator handing its resource down) still happens.
+			template <class U, class... Args>
+			void construct(U *p, Args&&... args) {
+				std::allocator_traits<base_allocator>::construct(this->_base, p, std::forward<Args>(args)...);
+			}
+			template <class U>
+			void destroy(U *p) {std::allocator_traits<base_allocator>::destroy(this->_base, p);}
+			stats_allocator select_on_container_copy_construction(void) const {
+				return stats_allocator(std::allocator_traits<base_allocator>::select_on_container_copy_construction(this->_base));
+			}
+
+			size_type max_size(void) const {return this->_base.max_size();}
+			base_allocator const & base(void) const {return this->_base;}
+			static alloc_stats & stats(void) {return stats_for<Tag>();}
+	};
+
+	template <class T, class U, class Tag, class A, class B>
+	inline bool operator==(stats_allocator<T, Tag, A> const & lhs, stats_allocator<U, Tag, B> const & rhs) {
+		return lhs.base() == rhs.base();
+	}
+
+	template <class T, class U, class Tag, class A, class B>
+	inline bool operator!=(stats_allocator<T, Tag, A> const & lhs, stats_allocator<U, Tag, B> const & rhs) {
+		return !(lhs == rhs);
+	}
+	/* -------------------------------------------------------------------------- */
+}
+
+#endif
@@ -5,7 +5,11 @@
 // and the range they represent by using the members of the 
 // corresponding iterator_traits instantiation.
 
+# include <cstddef>
+# include <cstring>
+# include <iterator>
 # include <type_traits>
+# include "utility.hpp"
 
 namespace ft {
 	template <class Iterator>
@@ -35,8 +39,73 @@ namespace ft {
 		typedef std::random_access_iterator_tag iterator_category;
 	};
 
+	// Iterators over elements laid out back to back in memory, so that a range
+	// [first, first + n) can be handed to memcpy through ft::to_address(first).
+	// Raw pointers qualify; wrap_iter specializes it in iterator.hpp.
+	template <class Iterator>
+	struct is_contiguous_iterator : public false_type {};
+
+	template <class T>
+	struct is_contiguous_iterator<T*> : public true_type {};
+
+	template <class T>
+	inline T* to_address(T* p) {return p;}
+
+	template <class InputIterator>
+	typename iterator_traits<InputIterator>::difference_type
+	_distance(InputIterator first, InputIterator last, std::input_iterator_tag) {
+		typename iterator_traits<InputIterator>::difference_type n = 0;
+		for (; first != last; ++first)
+			++n;
+		return n;
+	}
+	template <class RandomAccessIterator>
+	typename iterator_traits<RandomAccessIterator>::difference_type
+	_distance(RandomAccessIterator first, RandomAccessIterator last, std::random_access_iterator_tag) {
+		return last - first;
+	}
+	template <class InputIterator>
+	typename iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last) {
+		return _distance(first, last, typename iterator_traits<InputIterator>::iterator_category());
+	}
+
+	// A type is trivially relocatable when moving an object to a new address and
+	// forgetting the old one is the same as copying its bytes. Containers use it
+	// to grow and shift with memcpy/memmove instead of construct + destroy.
+	// Every trivially copyable type qualifies; specialize it to opt a type in
+	// (e.g. one that owns a heap pointer), never for a type that points into itself.
+	template <class T>
+	struct is_trivially_relocatable : public integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+
+	// The alignment every block from Alloc is guaranteed to have: Alloc::alignment
+	// when the allocator declares one (aligned_allocator does), else alignof(T).
+	template <class Alloc, class T, class = void>
+	struct allocator_alignment : public integral_constant<std::size_t, alignof(T)> {};
+	template <class Alloc, class T>
+	struct allocator_alignment<Alloc, T, typename enable_if<(Alloc::alignment > 0)>::type>
+		: public integral_constant<std::size_t, Alloc::alignment> {};
+
+	// Both ranges are contiguous over the same value type: the algorithms below
+	// drop to raw pointers through ft::to_address and reach the memcmp paths.
+	template <class Iterator1, class Iterator2>
+	struct _same_contiguous : public integral_constant<bool,
+		is_contiguous_iterator<Iterator1>::value && is_contiguous_iterator<Iterator2>::value
+		&& std::is_same<typename iterator_traits<Iterator1>::value_type,
+			typename iterator_traits<Iterator2>::value_type>::value> {};
+
+	template <class T>
+	bool equal(T* first1, T* last1, T* first2);
+	template <class T>
+	bool lexicographical_compare(T* first1, T* last1, T* first2, T* last2);
+
 	template <class InputIterator1, class InputIterator2>
-	bool equal ( InputIterator1 first1, InputIterator1 last1, InputIterator2 first2 ) {
+	bool _equal_iter(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, true_type) {
+		typedef const typename iterator_traits<InputIterator1>::value_type * raw;
+		raw raw1 = to_address(first1);
+		return ft::equal(raw1, raw1 + (last1 - first1), static_cast<raw>(to_address(first2)));
+	}
+	template <class InputIterator1, class InputIterator2>
+	bool _equal_iter(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, false_type) {
 		while (first1!=last1) {
 			if (!(*first1 == *first2))
 			return false;
@@ -44,10 +113,22 @@ namespace ft {
 		}
 		return true;
 	}
+	template <class InputIterator1, class InputIterator2>
+	bool equal ( InputIterator1 first1, InputIterator1 last1, InputIterator2 first2 ) {
+		return _equal_iter(first1, last1, first2, _same_contiguous<InputIterator1, InputIterator2>());
+	}
 
 	template <class InputIterator1, class InputIterator2>
-	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
-									InputIterator2 first2, InputIterator2 last2) {
+	bool _lexicographical_compare_iter (InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, true_type) {
+		typedef const typename iterator_traits<InputIterator1>::value_type * raw;
+		raw raw1 = to_address(first1);
+		raw raw2 = to_address(first2);
+		return ft::lexicographical_compare(raw1, raw1 + (last1 - first1), raw2, raw2 + (last2 - first2));
+	}
+	template <class InputIterator1, class InputIterator2>
+	bool _lexicographical_compare_iter (InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2, false_type) {
 		while (first1!=last1) {
 			if (first2==last2 || *first2<*first1) return false;
 			else if (*first1<*first2) return true;
@@ -55,6 +136,84 @@ namespace ft {
 		}
 		return (first2!=last2);
 	}
+	template <class InputIterator1, class InputIterator2>
+	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
+									InputIterator2 first2, InputIterator2 last2) {
+		return _lexicographical_compare_iter(first1, last1, first2, last2,
+			_same_contiguous<InputIterator1, InputIterator2>());
+	}
+
+	// Values of these types are equal exactly when their bytes are: no padding,
+	// no NaN, no distinct representations of the same value.
+	template <class T>
+	struct is_bitwise_comparable : public integral_constant<bool,
+		std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {};
+
+	// memcmp also orders these types: single unsigned bytes.
+	template <class T>
+	struct is_memcmp_orderable : public integral_constant<bool,
+		std::is_integral<T>::value && std::is_unsigned<T>::value && sizeof(T) == 1> {};
+
+	// Contiguous overloads, picked over the generic ones for raw pointers.
+	template <class T>
+	bool _equal(const T* first1, const T* last1, const T* first2, true_type) {
+		return first1 == last1 || std::memcmp(first1, first2, (last1 - first1) * sizeof(T)) == 0;
+	}
+	template <class T>
+	bool _equal(const T* first1, const T* last1, const T* first2, false_type) {
+		for (; first1 != last1; ++first1, ++first2)
+			if (!(*first1 == *first2))
+				return false;
+		return true;
+	}
+	template <class T>
+	bool equal(T* first1, T* last1, T* first2) {
+		return _equal(first1, last1, first2, integral_constant<bool, is_bitwise_comparable<T>::value>());
+	}
+
+	// Index of the first element that differs, or n. Equal 256-byte blocks are
+	// skipped with memcmp, only the block that differs is scanned element-wise.
+	template <class T>
+	std::size_t _mismatch(const T* first1, const T* first2, std::size_t n) {
+		const std::size_t block = 256 / sizeof(T) ? 256 / sizeof(T) : 1;
+		std::size_t i = 0;
+
+		while (i + block <= n && std::memcmp(first1 + i, first2 + i, block * sizeof(T)) == 0)
+			i += block;
+		while (i < n && first1[i] == first2[i])
+			++i;
+		return i;
+	}
+	template <class T>
+	bool _lexicographical_compare(const T* first1, std::size_t n1, const T* first2, std::size_t n2,
+		true_type, true_type) {
+		std::size_t n = n1 < n2 ? n1 : n2;
+		int diff = n ? std::memcmp(first1, first2, n * sizeof(T)) : 0;
+		return diff != 0 ? diff < 0 : n1 < n2;
+	}
+	template <class T>
+	bool _lexicographical_compare(const T* first1, std::size_t n1, const T* first2, std::size_t n2,
+		true_type, false_type) {
+		std::size_t i = _mismatch(first1, first2, n1 < n2 ? n1 : n2);
+		if (i < n1 && i < n2)
+			return first1[i] < first2[i];
+		return n1 < n2;
+	}
+	template <class T, class Orderable>
+	bool _lexicographical_compare(const T* first1, std::size_t n1, const T* first2, std::size_t n2,
+		false_type, Orderable) {
+		for (std::size_t i = 0; i < n1; ++i) {
+			if (i == n2 || first2[i] < first1[i]) return false;
+			else if (first1[i] < first2[i]) return true;
+		}
+		return n1 < n2;
+	}
+	template <class T>
+	bool lexicographical_compare(T* first1, T* last1, T* first2, T* last2) {
+		return _lexicographical_compare(first1, last1 - first1, first2, last2 - first2,
+			integral_constant<bool, is_bitwise_comparable<T>::value>(),
+			integral_constant<bool, is_memcmp_orderable<T>::value>());
+	}
 } 
 
 #endif
@@ -1,12 +1,15 @@
 #ifndef UTILITY_HPP
 # define UTILITY_HPP
 
+# include <cstddef>
+# include <utility>
+
 namespace ft {
 	template<typename T>
 	void swap(T & lhs, T & rhs) {
-		T buf(rhs);
-		rhs = lhs;
-		lhs = buf;
+		T buf(std::move(rhs));
+		rhs = std::move(lhs);
+		lhs = std::move(buf);
 	}
 
 	// std::pair is a class template that provides a way to store two heterogeneous objects as a single unit.
@@ -41,6 +44,20 @@ namespace ft {
 		return pair<T1, T2>(x, y);
 	}
 
+	// What a container holds on the heap, in bytes:
+	//	• payload  - live elements;
+	//	• slack    - allocated room nobody uses yet (capacity() - size());
+	//	• overhead - bookkeeping around the elements (tree nodes, sentinels).
+	struct memory_usage_info {
+		std::size_t payload;
+		std::size_t slack;
+		std::size_t overhead;
+
+		memory_usage_info(std::size_t p = 0, std::size_t s = 0, std::size_t o = 0)
+			: payload(p), slack(s), overhead(o) {}
+		std::size_t total(void) const {return this->payload + this->slack + this->overhead;}
+	};
+
 	template <typename T>
 	class less {
 		public: